@@ -16,6 +16,7 @@
 #include "dofman/unknowntype.h"
 #include "input/varscaletype.h"
 #include "math/numericalcmpn.h"
+#include "math/sparsemtrxtype.h"
 #include "input/valuemodetype.h"
 #include "input/problemmode.h"
 #include "input/fmode.h"
@@ -57,6 +58,11 @@
 
 #define _IFT_EngngModel_suppressOutput "suppress_output" // Suppress writing to .out file
 
+#define _IFT_EngngModel_assemblyMode "assemblymode" ///< Element scatter mode (0 = locked, 1 = coloured)
+#define _IFT_EngngModel_assemblyTiming "assemblytiming" ///< Reports wall time of element assembly
+#define _IFT_EngngModel_checkpointMode "checkpointmode" ///< Context files mode (0 = plain synchronous, 1 = asynchronous incremental compressed)
+#define _IFT_EngngModel_checkpointBase "checkpointbase" ///< Number of incremental context files between full snapshots
+
 //@}
 
 namespace oofem {
@@ -82,6 +88,8 @@ class ProcessCommunicatorBuff;
 class CommunicatorBuff;
 class ProcessCommunicator;
 class UnknownNumberingScheme;
+class SparseMtrxStructureCache;
+class CheckpointWriter;
 
 
 /**
@@ -173,6 +181,19 @@ public:
         //IG_Extrapolated = 2, ///< Assumes constant increment extrapolating @f$ {}^{n+1}x = {}^{n}x + \Delta t\delta{x}'@f$, where @f$ \delta x' = ({}^{n}x - {}^{n-1}x)/{}^{n}Delta t@f$.
     };
 
+    /**
+     * Determines how element contributions are scattered into global sparse matrices.
+     * In threaded runs, the locked mode serializes the scatter of every element,
+     * while the coloured mode processes the element colouring of the domain (see ConnectivityTable)
+     * colour by colour; elements of one colour share no equations and are scattered without locks.
+     * Matrices whose assemble is not safe for this (see SparseMtrx::supportsColouredAssembly) are always
+     * assembled in the locked mode.
+     */
+    enum AssemblyMode {
+        AM_Locked = 0,
+        AM_Coloured = 1,
+    };
+
 protected:
     /// Number of receiver domains.
     int ndomains;
@@ -194,6 +215,14 @@ protected:
     bool profileOpt;
     /// Equation numbering completed flag.
     int equationNumberingCompleted;
+    /// Equation numbering state stamp, incremented whenever equations may have been renumbered.
+    int numberingStamp;
+    /// Number of sparse matrix structures reused from the symbolic cache.
+    int symbolicCacheHits;
+    /// Number of sparse matrix structures built because the equation numbering changed.
+    int symbolicCacheMisses;
+    /// Structures shared with other models solving identical problems (optional).
+    std::shared_ptr< SparseMtrxStructureCache > sharedStructures;
     /// Number of meta steps.
     int nMetaSteps;
     /// List of problem metasteps.
@@ -218,6 +247,8 @@ protected:
     /// Domain context output mode.
     ContextOutputMode contextOutputMode;
     int contextOutputStep;
+    /// Writer of asynchronous incremental context files (null for plain context files).
+    std :: unique_ptr< CheckpointWriter >checkpointWriter;
 
     /// Export module manager.
     ExportModuleManager exportModuleManager;
@@ -288,8 +319,20 @@ protected:
     /// Flag for suppressing output to file.
     bool suppressOutput;
 
+    /// Scatter mode of matrix assembly.
+    AssemblyMode assemblyMode;
+    /// Flag for reporting timing of matrix assembly.
+    bool assemblyTiming;
+    /// Accumulated wall time of element matrix assembly (only tracked with assemblyTiming).
+    double assemblyWTime;
+
     std::string simulationDescription;
 
+    /// Stops given assembly timer, logs its wall time and adds it to the accumulated assembly time.
+    void reportAssemblyTime(Timer &assemblyTimer);
+    /// Computes the signature of the equation numbering of given domain (hash of dof equations and element connectivity).
+    std::size_t computeNumberingKey(int di, const UnknownNumberingScheme &s);
+
 public:
     /**
      * Constructor. Creates Engng model with number i.
@@ -754,6 +797,13 @@ public:
      * @param stepVersion Version of step.
      */
     std :: string giveContextFileName(int tStepNumber, int stepVersion) const;
+    /**
+     * Opens the context file of given step for reading. Both plain and incremental (compressed) context files
+     * are accepted, pending asynchronous writes are finished first.
+     * @param tStepNumber Solution step number to restore.
+     * @param stepVersion Version of step.
+     */
+    std :: unique_ptr< DataStream >giveContextInputStream(int tStepNumber, int stepVersion);
     /**
      * Returns the filename for the given domain (used by adaptivity and restore)
      * @param domainNum Domain number.
@@ -814,6 +864,34 @@ public:
      * to dofManagers.
      */
     virtual int forceEquationNumbering();
+    /**
+     * Builds the internal structure of given sparse matrix for given domain, unless the structure was already
+     * built for the same equation numbering (symbolic cache). The cache is keyed on the signature of the equation
+     * numbering and element connectivity, so renumbering which reproduces the same equations (e.g. fixed topology
+     * with unchanged Dirichlet conditions) keeps the sparsity pattern, the symbolic factorization and the values
+     * of the matrix. Hits and misses are counted and reported in the log.
+     * @param answer Matrix to build; should be used only through this method so that its structure key stays valid.
+     * @param di Domain number.
+     * @param s Equation numbering scheme.
+     * @return True if the matrix was kept as it is, false if its structure was rebuilt and it has to be assembled again.
+     */
+    bool buildSparseMtrxStructure(SparseMtrx &answer, int di, const UnknownNumberingScheme &s);
+    /**
+     * Creates the matrix of given type (if answer is null or of different type) and builds its structure as above.
+     * With shared structures (see shareSparseMtrxStructures), a new matrix is created as a copy of a shared
+     * structure built for the same equation numbering, and newly built structures are shared.
+     * @param answer Matrix to create and build.
+     * @param type Requested matrix type.
+     * @param di Domain number.
+     * @param s Equation numbering scheme.
+     * @return True if the matrix was kept as it is, false if it was created or rebuilt and has to be assembled.
+     */
+    bool buildSparseMtrxStructure(std::unique_ptr< SparseMtrx > &answer, SparseMtrxType type, int di, const UnknownNumberingScheme &s);
+    /**
+     * Lets the receiver share the sparse matrix structures (and their symbolic factorizations) with other models
+     * using the same cache. Intended for many instances of one problem, e.g. RVEs of multiscale materials.
+     */
+    void shareSparseMtrxStructures(std::shared_ptr< SparseMtrxStructureCache > cache) { this->sharedStructures = std::move(cache); }
     /**
      * Indicates if EngngModel requires Dofs dictionaries to be updated.
      * If EngngModel does not support changes
@@ -0,0 +1,89 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef checkpointwriter_h
+#define checkpointwriter_h
+
+#include "oofemcfg.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <cstddef>
+
+namespace oofem {
+class DataStream;
+
+/**
+ * Writer of asynchronous, incremental and compressed context files (checkpoints).
+ * The context is saved into a MemoryDataStream on the calling thread, the snapshot is then split into blocks,
+ * compared with the last full snapshot (the base), compressed and written by a background thread while the
+ * computation continues. Every checkpointBase-th file is a full snapshot, the files in between store only the
+ * blocks which differ from the base, together with the name of the base file. Blocks are compressed with a fast
+ * LZ77 compressor (byte oriented, in the spirit of LZ4), blocks which do not compress are stored as they are.
+ *
+ * The files are read by openContextFile, which also accepts plain context files written by FileDataStream,
+ * so restarting (-r) works for both. A delta file needs its base file to be present.
+ */
+class OOFEM_EXPORT CheckpointWriter
+{
+protected:
+    /// Number of incremental files between full snapshots.
+    int baseInterval;
+    /// Number of incremental files written since the last full snapshot.
+    int nDeltas;
+    /// Last full snapshot and name of its file.
+    std :: vector< char >base;
+    std :: string baseFileName;
+    /// Background thread writing the last checkpoint.
+    std :: thread worker;
+    /// Error of background thread, reported on the calling thread.
+    std :: string error;
+
+public:
+    /// Size of blocks the snapshots are split into.
+    static constexpr std :: size_t blockSize = 64 * 1024;
+
+    CheckpointWriter(int baseInterval = 10);
+    CheckpointWriter(const CheckpointWriter &) = delete;
+    CheckpointWriter &operator = ( const CheckpointWriter & ) = delete;
+    /// Destructor, finishes the pending write.
+    ~CheckpointWriter();
+
+    /**
+     * Writes the snapshot to file in background, waits for the previous write to finish first.
+     * @param fileName Name of the context file.
+     * @param data Snapshot of the context (contents of MemoryDataStream).
+     */
+    void write(std :: string fileName, std :: vector< char >data);
+    /// Waits until pending write is finished, reports errors of the background thread.
+    void wait();
+
+    /**
+     * Opens context file for reading. Checkpoint files are decompressed (and applied to their base) into memory,
+     * other files are opened as FileDataStream.
+     * @exception FileDataStream :: CantOpen if the file (or its base) can not be opened.
+     */
+    static std :: unique_ptr< DataStream >openContextFile(const std :: string &fileName);
+
+    /**
+     * Compresses data, returns the compressed size, or 0 if the data do not compress.
+     * @param answer Buffer of at least size bytes.
+     */
+    static std :: size_t compress(const char *data, std :: size_t size, char *answer);
+    /**
+     * Decompresses data, returns false if the data are corrupted.
+     * @param answer Buffer of exactly the uncompressed size.
+     */
+    static bool decompress(const char *data, std :: size_t size, char *answer, std :: size_t answerSize);
+
+protected:
+    /// Writes checkpoint file (runs in the background thread).
+    void writeFile(const std :: string &fileName, std :: vector< char > &data);
+    /// Reads checkpoint file into memory.
+    static void readFile(const std :: string &fileName, std :: vector< char > &answer, int depth);
+};
+} // end namespace oofem
+#endif // checkpointwriter_h
@@ -11,6 +11,7 @@
 #include <cstdio>
 #include <exception>
 #include <stdexcept>
+#include <vector>
 
 namespace oofem {
 /**
@@ -146,5 +147,54 @@ public:
     int givePackSizeOfLong(int count) override;
 };
 
+
+/**
+ * Implementation of DataStream in memory.
+ * Written data are appended to a growing byte buffer, reading starts at the beginning of the buffer.
+ * Used to take a snapshot of the context, which is then written to file independently (see CheckpointWriter).
+ */
+class OOFEM_EXPORT MemoryDataStream : public DataStream
+{
+protected:
+    /// Stored data.
+    std :: vector< char >buffer;
+    /// Reading position.
+    std :: size_t position;
+
+public:
+    /// Constructor, creates empty stream for writing.
+    MemoryDataStream() : buffer(), position(0) { }
+    /// Constructor, creates stream for reading given data.
+    MemoryDataStream(std :: vector< char >data) : buffer(std :: move(data) ), position(0) { }
+
+    /// Returns the stored data.
+    const std :: vector< char > &giveBuffer() const { return buffer; }
+    /// Returns the stored data, the receiver becomes empty.
+    std :: vector< char >releaseBuffer() { position = 0; return std :: move(buffer); }
+
+    int read(int *data, int count) override { return this->readBytes(data, sizeof( int ) * count); }
+    int read(unsigned long *data, int count) override { return this->readBytes(data, sizeof( unsigned long ) * count); }
+    int read(long *data, int count) override { return this->readBytes(data, sizeof( long ) * count); }
+    int read(double *data, int count) override { return this->readBytes(data, sizeof( double ) * count); }
+    int read(char *data, int count) override { return this->readBytes(data, count); }
+    int read(bool &data) override { return this->readBytes(& data, sizeof( bool ) ); }
+
+    int write(const int *data, int count) override { return this->writeBytes(data, sizeof( int ) * count); }
+    int write(const unsigned long *data, int count) override { return this->writeBytes(data, sizeof( unsigned long ) * count); }
+    int write(const long *data, int count) override { return this->writeBytes(data, sizeof( long ) * count); }
+    int write(const double *data, int count) override { return this->writeBytes(data, sizeof( double ) * count); }
+    int write(const char *data, int count) override { return this->writeBytes(data, count); }
+    int write(bool data) override { return this->writeBytes(& data, sizeof( bool ) ); }
+
+    int givePackSizeOfInt(int count) override { return sizeof( int ) * count; }
+    int givePackSizeOfDouble(int count) override { return sizeof( double ) * count; }
+    int givePackSizeOfChar(int count) override { return sizeof( char ) * count; }
+    int givePackSizeOfBool(int count) override { return sizeof( bool ) * count; }
+    int givePackSizeOfLong(int count) override { return sizeof( long ) * count; }
+
+protected:
+    int readBytes(void *data, std :: size_t size);
+    int writeBytes(const void *data, std :: size_t size);
+};
 } // end namespace oofem
 #endif // datastream_h
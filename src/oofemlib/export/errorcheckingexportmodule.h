@@ -153,7 +153,7 @@ public:
     const char *giveClassName() const override { return "EigenValueErrorCheckingRule"; }
 };
 
-/// Checks a reaction force value
+/// Checks the time of a solution step
 class OOFEM_EXPORT TimeCheckingRule : public ErrorCheckingRule
 {
 public:
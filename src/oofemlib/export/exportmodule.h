@@ -12,6 +12,7 @@
 #include "utility/set.h"
 
 #include <list>
+#include <functional>
 
 ///@name Input fields for export module
 //@{
@@ -103,6 +104,14 @@ public:
      * @param tStep time step.
      */
     void doForcedOutput(TimeStep *tStep) { doOutput(tStep, true); }
+    /**
+     * Prepares asynchronous output. Takes a snapshot of the data to be exported and returns the task writing it,
+     * the task is run later by a different thread and must not access the model.
+     * Modules not supporting asynchronous output return an empty task, doOutput is used instead.
+     * @param tStep Time step.
+     * @param forcedOutput If true, no testTimeStepOutput should be done.
+     */
+    virtual std :: function< void() >giveOutputTask(TimeStep *tStep, bool forcedOutput = false) { return nullptr; }
     /**
      * Initializes receiver.
      * The init file messages should be printed.
@@ -8,15 +8,51 @@
 #include "input/modulemanager.h"
 #include "export/exportmodule.h"
 
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+///@name Input fields for ExportModuleManager
+//@{
+#define _IFT_ExportModuleManager_asyncOutput "asyncoutput"
+//@}
+
 namespace oofem {
 class EngngModel;
 
 /**
  * Class representing and implementing ExportModuleManager. It is attribute of EngngModel.
  * It manages the export output modules, which perform module - specific output operations.
+ *
+ * In asynchronous mode (asyncoutput n, n > 0), modules supporting it (see ExportModule::giveOutputTask) only take
+ * a snapshot of the exported data on the calling thread; the files are serialized and written by a background writer
+ * thread while the computation continues. At most n snapshots wait in the queue, further output blocks until
+ * the writer catches up. The queue is flushed by terminate.
  */
 class OOFEM_EXPORT ExportModuleManager : public ModuleManager< ExportModule >
 {
+protected:
+    /// Max number of queued output tasks, 0 for synchronous output.
+    int asyncQueueSize;
+    /// Queued output tasks.
+    std::deque< std::function< void() > >taskQueue;
+    /// Background writer thread.
+    std::thread writer;
+    std::mutex queueMutex;
+    /// Signals new task or stop request to the writer.
+    std::condition_variable taskAvailable;
+    /// Signals free space in queue or finished task to producers.
+    std::condition_variable taskDone;
+    /// Number of tasks being processed by the writer.
+    int activeTasks;
+    /// Stop request for the writer.
+    bool stopWriter;
+    /// First error thrown by a task, rethrown on the calling thread.
+    std::exception_ptr writerError;
+
 public:
     ExportModuleManager(EngngModel * emodel);
     virtual ~ExportModuleManager();
@@ -38,7 +74,22 @@ public:
      * Terminates the receiver, the corresponding terminate module services are called.
      */
     void terminate();
+    /**
+     * Waits until all queued output is written.
+     * Errors raised by the writer are rethrown.
+     */
+    void flush();
+    /// Returns true if output is written asynchronously.
+    bool isAsynchronous() const { return asyncQueueSize > 0; }
     const char *giveClassName() const override { return "ExportModuleManager"; }
+
+protected:
+    /// Adds task to the queue, waits if the queue is full.
+    void enqueueOutputTask(std::function< void() > task);
+    /// Main loop of the writer thread.
+    void processOutputTasks();
+    /// Stops the writer thread (after processing the queued tasks).
+    void stopOutputWriter();
 };
 } // end namespace oofem
 #endif // exportmodulemanager_h
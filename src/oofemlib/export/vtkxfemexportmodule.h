@@ -56,6 +56,10 @@ public:
 
     void initializeFrom(InputRecord &ir) override;
     void doOutput(TimeStep *tStep, bool forcedOutput = false) override;
+#ifndef __VTK_MODULE
+    /// Output of enrichment items is always written synchronously.
+    std::function< void() >giveOutputTask(TimeStep *tStep, bool forcedOutput = false) override { return nullptr; }
+#endif
     void terminate() override {}
     const char *giveClassName() const override { return "VTKXMLXFemExportModule"; }
 
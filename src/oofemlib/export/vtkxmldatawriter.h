@@ -0,0 +1,71 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef vtkxmldatawriter_h
+#define vtkxmldatawriter_h
+
+#include "oofemcfg.h"
+
+#include <ostream>
+#include <string>
+#include <cstddef>
+
+namespace oofem {
+/**
+ * Writes DataArray elements of VTK XML files.
+ * In ascii format, the values are written inline. In appended format, only the reference to the data
+ * is written inline, the values are collected as raw binary blocks (with UInt64 headers) and written in the
+ * AppendedData section at the end of the file. The appended blocks can be compressed by zlib
+ * (only if compiled with __ZLIB_MODULE).
+ * Each output file should use its own writer, so files can be written concurrently.
+ */
+class OOFEM_EXPORT VTKXMLDataWriter
+{
+public:
+    enum DataFormat { DF_Ascii = 0, DF_Appended = 1 };
+
+protected:
+    /// Output format.
+    DataFormat format;
+    /// Flag for zlib compression of appended data.
+    bool compressed;
+    /// Appended data collected so far.
+    std::string appendedData;
+
+public:
+    VTKXMLDataWriter(DataFormat format = DF_Ascii, bool compressed = false);
+
+    DataFormat giveFormat() const { return format; }
+    bool isCompressed() const { return compressed; }
+    /// Returns true if compression is available in this build.
+    static bool isCompressionAvailable();
+
+    /**
+     * Returns the opening VTKFile element.
+     * @param type Type of file (e.g. UnstructuredGrid).
+     */
+    std::string giveFileHeader(const char *type) const;
+
+    /**
+     * Writes a DataArray element.
+     * @param stream Output stream.
+     * @param name Name of array, omitted if null.
+     * @param ncomponents Number of components, omitted if zero.
+     * @param values Array values.
+     * @param size Number of values.
+     */
+    void writeDataArray(std::ostream &stream, const char *name, int ncomponents, const double *values, std::size_t size);
+    void writeDataArray(std::ostream &stream, const char *name, int ncomponents, const int *values, std::size_t size);
+    void writeDataArray(std::ostream &stream, const char *name, int ncomponents, const unsigned char *values, std::size_t size);
+
+    /// Writes the AppendedData element (if there are any appended data) and clears them.
+    void writeAppendedData(std::ostream &stream);
+
+protected:
+    template< class T > void writeArray(std::ostream &stream, const char *type, const char *name, int ncomponents, const T *values, std::size_t size);
+    /// Appends a (possibly compressed) block of data, including its header.
+    void appendBlock(const char *data, std::size_t nbytes);
+};
+} // end namespace oofem
+#endif // vtkxmldatawriter_h
@@ -6,6 +6,7 @@
 #define vtkxmlexportmodule_h
 
 #include "export/vtkbaseexportmodule.h"
+#include "export/vtkxmldatawriter.h"
 #include "math/intarray.h"
 #include "nodalrecovery/nodalrecoverymodel.h"
 #include "utility/interface.h"
@@ -30,6 +31,7 @@
 
 #include <string>
 #include <list>
+#include <vector>
 
 ///@name Input fields for VTK XML export module
 //@{
@@ -40,6 +42,9 @@
 #define _IFT_VTKXMLExportModule_externalForces "externalforces"
 #define _IFT_VTKXMLExportModule_ipvars "ipvars"
 #define _IFT_VTKXMLExportModule_stype "stype"
+#define _IFT_VTKXMLExportModule_format "format" ///< 0 - ascii (default), 1 - appended raw binary
+#define _IFT_VTKXMLExportModule_compression "compression" ///< Compresses binary data by zlib (if available)
+#define _IFT_VTKXMLExportModule_pvtu "pvtu" ///< Writes each piece to separate file, referenced by .pvtu file
 //@}
 
 using namespace std;
@@ -52,6 +57,9 @@ class Node;
  * some internal variables at region boundaries.
  * Each region is usually exported as a single piece. When region contains composite cells, these are assumed to be
  * exported in individual subsequent pieces after the default one for the particular region.
+ * The data arrays are written either as ascii or as (optionally compressed) raw binary data in the appended section
+ * of the file. With pvtu output, each piece is written into a separate .vtu file (the files are written concurrently)
+ * and these are referenced by a .pvtu file.
  */
 class OOFEM_EXPORT VTKXMLExportModule : public VTKBaseExportModule
 {
@@ -82,6 +90,15 @@ protected:
     /// Buffer for earlier time steps with gauss points exported to *.gp.pvd file.
     std::list< std::string >gpPvdBuffer;
 
+    /// Format of data arrays.
+    VTKXMLDataWriter::DataFormat dataFormat;
+    /// Flag for compression of binary data.
+    bool compressData;
+    /// Flag for export of pieces into separate files referenced by .pvtu file.
+    bool pvtuOutput;
+    /// Writer of data arrays of fileStream.
+    VTKXMLDataWriter dataWriter;
+
 
 public:
     /// Constructor. Creates empty Output Manager. By default all components are selected.
@@ -91,6 +108,9 @@ public:
 
     void initializeFrom(InputRecord &ir) override;
     void doOutput(TimeStep *tStep, bool forcedOutput = false) override;
+#ifndef __VTK_MODULE
+    std::function< void() >giveOutputTask(TimeStep *tStep, bool forcedOutput = false) override;
+#endif
     void initialize() override;
     void terminate() override;
     const char *giveClassName() const override { return "VTKXMLExportModule"; }
@@ -129,11 +149,44 @@ protected:
     /// Returns the output stream for given solution step.
     std::ofstream giveOutputStream(TimeStep *tStep);
 
-    void writeIntVars(ExportRegion &vtkPiece);
+    /// Writes all pieces into single .vtu file.
+    void writeVTKFile(TimeStep *tStep);
+
     void writeXFEMVars(ExportRegion &vtkPiece);
+#ifdef __VTK_MODULE
+    void writeIntVars(ExportRegion &vtkPiece);
     void writePrimaryVars(ExportRegion &vtkPiece);
     void writeCellVars(ExportRegion &vtkPiece);
     void writeExternalForces(ExportRegion &vtkPiece);
+#else
+    void writeIntVars(std::ostream &stream, VTKXMLDataWriter &writer, ExportRegion &vtkPiece);
+    void writePrimaryVars(std::ostream &stream, VTKXMLDataWriter &writer, ExportRegion &vtkPiece);
+    void writeCellVars(std::ostream &stream, VTKXMLDataWriter &writer, ExportRegion &vtkPiece);
+    void writeExternalForces(std::ostream &stream, VTKXMLDataWriter &writer, ExportRegion &vtkPiece);
+    /// Writes piece header+geometry to given stream.
+    bool writeVTKPieceProlog(std::ostream &stream, VTKXMLDataWriter &writer, ExportRegion &vtkPiece);
+    /// Writes piece variables to given stream.
+    bool writeVTKPieceVariables(std::ostream &stream, VTKXMLDataWriter &writer, ExportRegion &vtkPiece);
+    /// Writes comment and opening elements of .vtu file.
+    void writeFileProlog(std::ostream &stream, VTKXMLDataWriter &writer, TimeStep *tStep);
+    /// Writes closing elements of .vtu file, including the appended data.
+    void writeFileEpilog(std::ostream &stream, VTKXMLDataWriter &writer);
+    /// Writes empty piece, otherwise ParaView complains if the whole vtu file is without <Piece></Piece>.
+    void writeEmptyPiece(std::ostream &stream);
+    /**
+     * Sets up all pieces, writes them concurrently into separate .vtu files and writes
+     * the .pvtu file referencing the nonempty ones.
+     */
+    void writeVTKPieceFiles(TimeStep *tStep);
+    /// Sets up all pieces (including the composite elements), the pieces hold copies of all exported values.
+    void setupVTKPieces(std::vector< ExportRegion > &pieces, TimeStep *tStep);
+    /// Writes given pieces into single .vtu file.
+    void writeVTKFile(std::vector< ExportRegion > &pieces, TimeStep *tStep);
+    /// Writes given pieces concurrently into separate .vtu files and writes the .pvtu file.
+    void writeVTKPieceFiles(std::vector< ExportRegion > &pieces, TimeStep *tStep);
+#endif
+    /// Adds entry of given step to the *.pvd file(s) and rewrites them.
+    void addVTKCollectionEntry(TimeStep *tStep);
     /**
      * Writes Piece header+geometry
      * @return true if piece is not empty and thus written
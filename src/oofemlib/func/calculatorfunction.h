@@ -6,6 +6,7 @@
 #define calculatorfunction_h
 
 #include "func/function.h"
+#include "utility/parser.h"
 
 ///@name Input fields for CalculatorFunction
 //@{
@@ -19,19 +20,33 @@
 namespace oofem {
 /**
  * Class representing user defined load time function. User input is function expression.
- * Uses Parser class to parse given expression. Slow but useful.
+ * The expressions are compiled by Parser once when the input is read; evaluation only binds the arguments
+ * to the variable slots of the compiled expression. Array arguments are accessible by component, e.g. x1, x2, x3.
  * Load time function typically belongs to domain and is
  * attribute of one or more loads. Generally load time function is real function of time (@f$ y=f(t) @f$).
  */
 class OOFEM_EXPORT CalculatorFunction : public Function
 {
 private:
+    /// Compiled expression with the argument binding of its input variables.
+    struct Expression {
+        CompiledExpression code;
+        /// Names of the arguments bound to slots; for array components (e.g. x2) the name of the array.
+        std :: vector< std :: string > argNames;
+        /// Component index of array arguments bound to slots (0 for variables bound directly).
+        std :: vector< int > argIndices;
+        /// Slot of time variable (-1 if not used).
+        int timeSlot = -1;
+    };
+
     /// Expression for the function value.
     std :: string fExpression;
     /// Expression for first time derivative.
     std :: string dfdtExpression;
     /// Expression for second time derivative.
     std :: string d2fdt2Expression;
+    /// Compiled expressions.
+    Expression f, dfdt, d2fdt2;
 
 public:
     /**
@@ -59,6 +74,14 @@ public:
 
     const char *giveClassName() const override { return "CalculatorFunction"; }
     const char *giveInputRecordName() const override { return _IFT_CalculatorFunction_Name; }
+
+private:
+    /// Compiles given expression string.
+    static void compile(Expression &answer, const std :: string &expression);
+    /// Sets the input slots of expression from given arguments.
+    static void bindArguments(const Expression &e, double *slots, const std :: map< std :: string, FunctionArgument > &valDict);
+    /// Evaluates expression depending on time only.
+    static double evaluateTimeExpression(const Expression &e, double t);
 };
 } // end namespace oofem
 #endif // calculatorfunction_h
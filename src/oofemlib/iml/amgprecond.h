@@ -0,0 +1,137 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef amgprecond_h
+#define amgprecond_h
+
+#include "math/floatarray.h"
+#include "math/floatmatrix.h"
+#include "precond.h"
+
+#include <vector>
+
+///@name Input fields for AMGPreconditioner
+//@{
+#define _IFT_AMGPreconditioner_theta "amgtheta"
+#define _IFT_AMGPreconditioner_sweeps "amgsweeps"
+#define _IFT_AMGPreconditioner_coarseSize "amgcoarsesize"
+#define _IFT_AMGPreconditioner_maxLevels "amgmaxlevels"
+//@}
+
+namespace oofem {
+class Domain;
+class CompCol;
+
+/**
+ * Smoothed aggregation algebraic multigrid preconditioner.
+ *
+ * The unknowns are grouped into blocks (all equations of one dof manager on the finest level, all coarse unknowns
+ * of one aggregate on coarser levels). Blocks are aggregated using the strength of connection of their matrix blocks
+ * (Frobenius norm), the tentative prolongator interpolates the near nullspace exactly within each aggregate
+ * (local QR factorization) and it is smoothed by one damped Jacobi step. For displacement and rotation dofs, the near
+ * nullspace is formed by the rigid body modes computed from the node coordinates; other dofs use constant modes.
+ * Coarse matrices are Galerkin products, the coarsest one is inverted directly. The preconditioner applies one
+ * V-cycle with block Jacobi smoothing (symmetric, so it can be used with CG).
+ *
+ * The aggregates and tentative prolongators are kept, so when the matrix is changed without changing its structure
+ * (e.g. in Newton iterations), only the numeric part of the setup is repeated.
+ * Works with CompCol and SymCompCol matrices numbered by the default equation numbering of the domain.
+ */
+class OOFEM_EXPORT AMGPreconditioner : public Preconditioner
+{
+protected:
+    /// Sparse matrix in compressed row format (0-based).
+    struct CSRMatrix {
+        int nrows = 0, ncols = 0;
+        std::vector< int > ptr, ind;
+        std::vector< double > val;
+
+        /// y = A x
+        void times(const double *x, double *y) const;
+        /// Returns the transposed matrix.
+        CSRMatrix transposed() const;
+        /// Returns the product of receiver and given matrix.
+        CSRMatrix product(const CSRMatrix &b) const;
+        /// Returns true if the receiver has the same nonzero pattern as given matrix.
+        bool hasSameStructure(const CSRMatrix &b) const;
+    };
+
+    /// One level of the hierarchy.
+    struct Level {
+        /// Level matrix.
+        CSRMatrix A;
+        /// Blocks (unknowns of block i are blockDofs[blockPtr[i]], ..., blockDofs[blockPtr[i+1]-1]).
+        std::vector< int > blockPtr, blockDofs;
+        /// Inverted diagonal blocks, stored row by row.
+        std::vector< double > invBlocks;
+        std::vector< std::size_t > invBlockPtr;
+        /// Damping of smoother.
+        double omega = 1.;
+        /// Tentative and smoothed prolongator to the next level, restriction (transposed prolongator).
+        CSRMatrix tentativeP, P, R;
+        /// Work arrays of V-cycle.
+        mutable std::vector< double > x, b, r, z;
+    };
+
+    /// Domain providing the dof managers and their coordinates.
+    Domain *domain;
+    /// Hierarchy of levels, the last one is solved directly.
+    std::vector< Level > levels;
+    /// Inverse of the coarsest matrix.
+    FloatMatrix coarseInverse;
+
+    /// Strength of connection threshold.
+    double theta;
+    /// Number of pre- and post-smoothing sweeps.
+    int sweeps;
+    /// Size of coarsest level.
+    int coarseSize;
+    /// Maximum number of levels.
+    int maxLevels;
+
+public:
+    /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
+    AMGPreconditioner(Domain *d = nullptr);
+    /// Destructor
+    virtual ~AMGPreconditioner(void) { }
+
+    void init(const SparseMtrx &a) override;
+    void solve(const FloatArray &rhs, FloatArray &solution) const override;
+    void trans_solve(const FloatArray &rhs, FloatArray &solution) const override;
+    void initializeFrom(InputRecord &ir) override;
+
+    /// Returns number of levels of the hierarchy.
+    int giveNumberOfLevels() const { return ( int ) levels.size(); }
+    const char *giveClassName() const override { return "AMGPre"; }
+
+protected:
+    /// Converts given matrix to compressed row format.
+    static void convertMatrix(CSRMatrix &answer, const CompCol &a, bool symmetric);
+    /// Sets up the blocks and the near nullspace of the finest level.
+    void giveFineBlocks(std::vector< int > &blockPtr, std::vector< int > &blockDofs, FloatMatrix &nullspace, int n) const;
+    /**
+     * Aggregates the blocks of given level and builds the tentative prolongator.
+     * @param level Level, blocks have to be set.
+     * @param nullspace Near nullspace of level, overwritten by the coarse nullspace.
+     * @param coarse Next level, its blocks are set.
+     * @return False if coarsening failed.
+     */
+    bool buildTentativeProlongator(Level &level, FloatMatrix &nullspace, Level &coarse) const;
+    /// Computes the numeric part of the setup of all levels (smoother, smoothed prolongator, coarse matrices).
+    void setupNumeric();
+    /// Sets up the smoother of level l, smooths its tentative prolongator and computes the matrix of level l+1.
+    void setupProlongator(int l);
+    /// Inverts the coarsest matrix and allocates the work arrays.
+    void setupCoarsest();
+    /// Inverts the diagonal blocks of given level and estimates the damping of smoother.
+    void setupSmoother(Level &level) const;
+    /// Estimates the largest eigenvalue of D^-1 A, D being the (block) diagonal.
+    double estimateSpectralRadius(const Level &level, bool blockDiagonal) const;
+    /// Applies the inverted (block) diagonal.
+    void applyBlockInverse(const Level &level, const double *x, double *y) const;
+    /// Applies V-cycle starting with zero initial guess, the result is stored in levels[l].x.
+    void vCycle(int l) const;
+};
+} // end namespace oofem
+#endif // amgprecond_h
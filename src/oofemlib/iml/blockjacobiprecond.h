@@ -0,0 +1,45 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef blockjacobiprecond_h
+#define blockjacobiprecond_h
+
+#include "math/floatarray.h"
+#include "math/floatmatrix.h"
+#include "math/intarray.h"
+#include "precond.h"
+
+#include <vector>
+
+namespace oofem {
+/**
+ * Block Jacobi preconditioner for matrix-free operators (see MatrixFreeSparseMtrx).
+ * The diagonal blocks coupling the equations of each dof manager are assembled from the element matrices and inverted,
+ * the preconditioner then applies the block diagonal inverse.
+ */
+class OOFEM_EXPORT BlockJacobiPreconditioner : public Preconditioner
+{
+private:
+    /// Inverted diagonal blocks.
+    std::vector< FloatMatrix > blocks;
+    /// Equations of the blocks.
+    std::vector< IntArray > eqs;
+
+public:
+    /// Constructor. Initializes the the receiver (constructs the precontioning matrix M) of given matrix.
+    BlockJacobiPreconditioner(const SparseMtrx &a, InputRecord &attributes);
+    /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
+    BlockJacobiPreconditioner() : Preconditioner() { }
+    /// Destructor
+    virtual ~BlockJacobiPreconditioner(void) { }
+
+    void init(const SparseMtrx &a) override;
+
+    void solve(const FloatArray &rhs, FloatArray &solution) const override;
+    void trans_solve(const FloatArray &rhs, FloatArray &solution) const override;
+
+    const char *giveClassName() const override { return "BlockJacobiPre"; }
+};
+} // end namespace oofem
+#endif // blockjacobiprecond_h
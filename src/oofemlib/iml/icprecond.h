@@ -35,11 +35,17 @@
 #include "math/intarray.h"
 #include "math/symcompcol.h"
 #include "precond.h"
+#include "levelschedule.h"
+
+#include <vector>
 
 namespace oofem {
 /**
  * Incomplete Cholesky IC(0) (no fill - up) preconditioner for
  * symmetric, positive definite matrices.
+ *
+ * Unless the serial schedule is requested, the factorization (row by row) and the triangular sweeps are level
+ * scheduled and run in parallel (see LevelSchedule).
  */
 class OOFEM_EXPORT CompCol_ICPreconditioner : public Preconditioner
 {
@@ -50,11 +56,26 @@ private:
     int nz;
     int dim [ 2 ];
 
+    /// Scheduling of factorization and sweeps (see LevelSchedule::Type).
+    int schedule;
+    /// Factor L of scheduled modes in compressed row format (sorted rows, diagonal is the last entry of row).
+    std::vector< int >rowPtr;
+    std::vector< int >rowInd;
+    std::vector< double >rowVal;
+    /// Factor L in compressed column format (diagonal is the first entry of column).
+    std::vector< int >colPtr;
+    std::vector< int >colInd;
+    std::vector< double >colVal;
+    /// Ordering of colour mode (perm[new] = old), empty for natural ordering.
+    std::vector< int >perm;
+    /// Schedules of factorization and forward sweep (lower) and of backward sweep (upper).
+    LevelSchedule lowerSchedule, upperSchedule;
+
 public:
     /// Constructor. Initializes the the receiver (constructs the precontioning matrix M) of given matrix.
     CompCol_ICPreconditioner(const SparseMtrx & A, InputRecord & attributes);
     /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
-    CompCol_ICPreconditioner() : Preconditioner() { }
+    CompCol_ICPreconditioner() : Preconditioner(), schedule(LevelSchedule :: LST_Serial) { }
     /// Destructor.
     virtual ~CompCol_ICPreconditioner(void) { }
 
@@ -74,6 +95,10 @@ protected:
 
     void ICSolve(FloatArray &dest) const;
     void ICFactor();
+
+    /// Level scheduled factorization of the lower triangle given in compressed column format.
+    void initializeScheduled(int n, const std::vector< int > &colptr, const std::vector< int > &rowind, const std::vector< double > &values);
+    void solveScheduled(const FloatArray &x, FloatArray &y) const;
 };
 } // end namespace oofem
 #endif // icprecond_h
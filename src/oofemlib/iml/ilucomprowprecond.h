@@ -10,6 +10,9 @@
 #include "math/intarray.h"
 #include "dyncomprow.h"
 #include "precond.h"
+#include "levelschedule.h"
+
+#include <vector>
 
 ///@name Input fields for CompRowPrecond
 //@{
@@ -21,6 +24,9 @@ namespace oofem {
 /**
  * Implemantation of ILU (Incomplete LU) Preconditioner for compressed row sparse matrices.
  * Fill - up supported.
+ *
+ * The factorization is serial (fill-in pattern is not known in advance), the triangular sweeps are level scheduled
+ * and run in parallel unless the serial schedule is requested. The colour mode is not supported, levels are used instead.
  */
 class OOFEM_EXPORT CompRow_ILUPreconditioner : public Preconditioner
 {
@@ -30,11 +36,18 @@ private:
     double drop_tol;
     int part_fill;
 
+    /// Scheduling of sweeps (see LevelSchedule::Type).
+    int schedule;
+    /// Position of diagonal in rows of factorized matrix.
+    std::vector< int >diagPos;
+    /// Schedules of forward sweep (lower) and of backward sweep (upper).
+    LevelSchedule lowerSchedule, upperSchedule;
+
 public:
     /// Constructor. Initializes the the receiver (constructs the precontioning matrix M) of given matrix.
     CompRow_ILUPreconditioner(const SparseMtrx & A, InputRecord & attributes);
     /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
-    CompRow_ILUPreconditioner() : Preconditioner() { }
+    CompRow_ILUPreconditioner() : Preconditioner(), schedule(LevelSchedule :: LST_Serial) { }
     /// Destructor
     virtual ~CompRow_ILUPreconditioner(void) { }
 
@@ -50,6 +63,9 @@ public:
     void initializeFrom(InputRecord &ir) override;
 
 protected:
+    /// Builds the schedules of the sweeps of the factorized matrix.
+    void buildSchedules();
+
     void qsortCol(IntArray &, FloatArray &, int l, int r);
     int  qsortColPartition(IntArray &, FloatArray &, int l, int r);
 };
@@ -36,11 +36,17 @@
 #include "input/compcol.h"
 #include "dyncompcol.h"
 #include "precond.h"
+#include "levelschedule.h"
+
+#include <vector>
 
 namespace oofem {
 /**
  * Implemantation of ILU (Incomplete LU) Preconditioner.
  * No fill-up - ILU(0).
+ *
+ * Unless the serial schedule is requested, the factorization (row by row) and the triangular sweeps are level
+ * scheduled and run in parallel (see LevelSchedule).
  */
 class OOFEM_EXPORT CompCol_ILUPreconditioner : public Preconditioner
 {
@@ -57,11 +63,23 @@ private:
 
     int dim [ 2 ];
 
+    /// Scheduling of factorization and sweeps (see LevelSchedule::Type).
+    int schedule;
+    /// Factors of scheduled modes in compressed row format (sorted rows), L (unit diagonal) and U share the rows.
+    std::vector< int >rowPtr;
+    std::vector< int >rowInd;
+    std::vector< int >rowDiag;
+    std::vector< double >rowVal;
+    /// Ordering of colour mode (perm[new] = old), empty for natural ordering.
+    std::vector< int >perm;
+    /// Schedules of factorization and forward sweep (lower) and of backward sweep (upper).
+    LevelSchedule lowerSchedule, upperSchedule;
+
 public:
     /// Constructor. Initializes the the receiver (constructs the precontioning matrix M) of given matrix.
     CompCol_ILUPreconditioner(const SparseMtrx & A, InputRecord & attributes);
     /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
-    CompCol_ILUPreconditioner() : Preconditioner() { }
+    CompCol_ILUPreconditioner() : Preconditioner(), schedule(LevelSchedule :: LST_Serial) { }
     /// Destructor
     virtual ~CompCol_ILUPreconditioner(void) { }
 
@@ -79,6 +97,11 @@ public:
 protected:
     void qsortRow(IntArray &, FloatArray &, int l, int r);
     int  qsortRowPartition(IntArray &, FloatArray &, int l, int r);
+
+    /// Level scheduled factorization of matrix given in compressed column format.
+    void initializeScheduled(int n, const std::vector< int > &colptr, const std::vector< int > &rowind, const std::vector< double > &values);
+    void solveScheduled(const FloatArray &x, FloatArray &y) const;
+    void trans_solveScheduled(const FloatArray &x, FloatArray &y) const;
 };
 } // end namespace oofem
 #endif // iluprecond_h
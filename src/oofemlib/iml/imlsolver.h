@@ -37,7 +37,7 @@ private:
     /// Solver type.
     enum IMLSolverType { IML_ST_CG, IML_ST_GMRES };
     /// Preconditioner type.
-    enum IMLPrecondType { IML_VoidPrec, IML_DiagPrec, IML_ILU_CompColPrec, IML_ILU_CompRowPrec, IML_ICPrec };
+    enum IMLPrecondType { IML_VoidPrec, IML_DiagPrec, IML_ILU_CompColPrec, IML_ILU_CompRowPrec, IML_ICPrec, IML_BlockJacobiPrec, IML_AMGPrec };
 
     /// Last mapped Lhs matrix
     SparseMtrx *lhs;
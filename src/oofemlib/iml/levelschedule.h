@@ -0,0 +1,104 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef levelschedule_h
+#define levelschedule_h
+
+#include "oofemcfg.h"
+
+#include <vector>
+
+///@name Input fields for scheduling of ILU/IC preconditioners
+//@{
+#define _IFT_LevelSchedule_type "precschedule"
+//@}
+
+namespace oofem {
+/**
+ * Level schedule of a sparse triangular sweep (factorization or forward/backward substitution).
+ * Rows are grouped into levels, so that each row depends only on rows of previous levels; the rows of one level
+ * are processed in parallel and the levels are separated by barriers.
+ *
+ * Each row is processed by a single thread with the same order of operations as in the serial sweep, so the results
+ * do not depend on the number of threads. In the colour mode, the unknowns are reordered by a greedy colouring of
+ * the matrix graph before the factorization, so the unknowns of one colour form one level. This gives much fewer
+ * levels, but the factors (and thus the preconditioner) differ from the ones in natural ordering.
+ */
+class OOFEM_EXPORT LevelSchedule
+{
+public:
+    /// Scheduling of preconditioners.
+    enum Type {
+        LST_Serial = 0, ///< Original serial algorithms.
+        LST_Levels = 1, ///< Level scheduling in natural ordering, same factors as serial.
+        LST_Colours = 2, ///< Level scheduling of coloured (reordered) system.
+    };
+
+protected:
+    /// Rows of level l are rows[levelPtr[l]], ..., rows[levelPtr[l+1]-1].
+    std :: vector< int >levelPtr;
+    std :: vector< int >rows;
+
+public:
+    LevelSchedule() { }
+
+    /**
+     * Builds the schedule.
+     * Row i depends on rows ind[first[i]], ..., ind[last[i]-1], which must precede row i in the sweep.
+     * @param n Number of rows.
+     * @param forward Sweep from the first to the last row, otherwise from the last one.
+     */
+    void build(int n, const int *first, const int *last, const int *ind, bool forward);
+    /// Clears the receiver.
+    void clear();
+
+    /// Returns number of levels.
+    int giveNumberOfLevels() const { return levelPtr.empty() ? 0 : ( int ) levelPtr.size() - 1; }
+    /// Returns number of rows.
+    int giveNumberOfRows() const { return ( int ) rows.size(); }
+
+    /// Calls f(row) for all rows, the rows of one level in parallel.
+    template< class Function >void apply(Function &&f) const;
+
+    /**
+     * Computes the colour ordering of a sparse matrix (greedy colouring of the graph of A+A^T in natural order).
+     * @param n Size of matrix.
+     * @param ptr Row (column) pointers.
+     * @param ind Column (row) indices.
+     * @param perm New ordering, perm[new] = old.
+     * @return Number of colours.
+     */
+    static int computeColouring(int n, const int *ptr, const int *ind, std :: vector< int > &perm);
+    /**
+     * Converts the matrix in compressed column format to the compressed row format with sorted rows, applying
+     * the symmetric permutation.
+     * @param perm Permutation (perm[new] = old), identity if empty.
+     * @param lowerTriangle If true, matrix is symmetric and only its lower triangle is stored, the result is the lower
+     * triangle of the permuted matrix.
+     */
+    static void convertToRows(int n, const int *colptr, const int *rowind, const double *values, const std :: vector< int > &perm, bool lowerTriangle,
+                              std :: vector< int > &ptr, std :: vector< int > &ind, std :: vector< double > &val);
+};
+
+
+template< class Function >
+void LevelSchedule :: apply(Function &&f) const
+{
+    int nlevels = this->giveNumberOfLevels();
+#ifdef _OPENMP
+ #pragma omp parallel if ( rows.size() > 2000 )
+#endif
+    {
+        for ( int l = 0; l < nlevels; l++ ) {
+#ifdef _OPENMP
+ #pragma omp for schedule(static)
+#endif
+            for ( int k = levelPtr [ l ]; k < levelPtr [ l + 1 ]; k++ ) {
+                f(rows [ k ]);
+            }
+        }
+    }
+}
+} // end namespace oofem
+#endif // levelschedule_h
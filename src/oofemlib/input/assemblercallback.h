@@ -10,6 +10,8 @@
 #include "material/matresponsemode.h"
 #include "input/chartype.h"
 
+#include <memory>
+
 namespace oofem {
 class IntArray;
 class FloatArray;
@@ -54,6 +56,14 @@ public:
 class OOFEM_EXPORT MatrixAssembler
 {
 public:
+    virtual ~MatrixAssembler() { }
+
+    /**
+     * Returns a copy of the receiver, or null if the assembler can not be copied.
+     * Needed by matrices applying the element contributions on the fly (see MatrixFreeSparseMtrx).
+     */
+    virtual std::unique_ptr< MatrixAssembler > clone() const { return nullptr; }
+
     virtual void matrixFromElement(FloatMatrix &mat, Element &element, TimeStep *tStep) const;
     virtual void matrixFromLoad(FloatMatrix &mat, Element &element, BodyLoad *load, TimeStep *tStep) const;
     virtual void matrixFromSurfaceLoad(FloatMatrix &mat, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep) const;
@@ -161,6 +171,8 @@ protected:
 public:
     TangentAssembler(MatResponseMode m = TangentStiffness): MatrixAssembler(), rmode(m) {}
 
+    std::unique_ptr< MatrixAssembler > clone() const override { return std::make_unique< TangentAssembler >(*this); }
+
     void matrixFromElement(FloatMatrix &mat, Element &element, TimeStep *tStep) const override;
     void matrixFromLoad(FloatMatrix &mat, Element &element, BodyLoad *load, TimeStep *tStep) const override;
     void matrixFromSurfaceLoad(FloatMatrix &mat, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep) const override;
@@ -176,6 +188,7 @@ public:
 class OOFEM_EXPORT MassMatrixAssembler : public MatrixAssembler
 {
 public:
+    std::unique_ptr< MatrixAssembler > clone() const override { return std::make_unique< MassMatrixAssembler >(*this); }
     void matrixFromElement(FloatMatrix &mat, Element &element, TimeStep *tStep) const override;
 };
 
@@ -193,6 +206,8 @@ protected:
 
 public:
     EffectiveTangentAssembler(MatResponseMode mode, bool lumped, double k, double m);
+
+    std::unique_ptr< MatrixAssembler > clone() const override { return std::make_unique< EffectiveTangentAssembler >(*this); }
     void matrixFromElement(FloatMatrix &mat, Element &element, TimeStep *tStep) const override;
     void matrixFromLoad(FloatMatrix &mat, Element &element, BodyLoad *load, TimeStep *tStep) const override;
     void matrixFromSurfaceLoad(FloatMatrix &mat, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep) const override;
@@ -45,11 +45,19 @@
 #include "math/sparsemtrx.h"
 #include "math/intarray.h"
 
+#include <vector>
+#include <atomic>
+#include <mutex>
+
 #define _IFT_CompCol_Name "csc"
 
 namespace oofem {
 /**
  * Implementation of sparse matrix stored in compressed column storage.
+ *
+ * For larger matrices, the products are computed in parallel (OpenMP) by rows; the row access to the stored entries
+ * is built on the first use and kept until the structure changes. Each entry of the answer is summed by a single
+ * thread in the same order as in the serial column loop, so the results do not depend on the number of threads.
  */
 class OOFEM_EXPORT CompCol : public SparseMtrx
 {
@@ -62,6 +70,13 @@ protected:
     int base;              // index base: offset of first element
     int nz;                // number of nonzeros
 
+    /// Row access to the stored entries (positions in val and columns of entries of each row), see buildRowAccess.
+    mutable std :: vector< int >rowAccessPtr;
+    mutable std :: vector< int >rowAccessPos;
+    mutable std :: vector< int >rowAccessCol;
+    mutable std :: atomic< bool >rowAccessValid;
+    mutable std :: mutex rowAccessMutex;
+
 public:
     /** Constructor. Before any operation an internal profile must be built.
      * @see buildInternalStructure
@@ -83,6 +98,7 @@ public:
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
     bool canBeFactorized() const override { return false; }
+    bool supportsColouredAssembly() const override { return true; }
     void zero() override;
     double &at(int i, int j) override;
     double at(int i, int j) const override;
@@ -93,9 +109,13 @@ public:
     bool isAsymmetric() const override { return true; }
 
     // Breaks encapsulation, but access is needed for PARDISO and SuperLU solvers;
+    // the structure may be changed through these only before the first product (the row access is not rebuilt).
     FloatArray &giveValues() { return val; }
     IntArray &giveRowIndex() { return rowind; }
     IntArray &giveColPtr() { return colptr; }
+    const FloatArray &giveValues() const { return val; }
+    const IntArray &giveRowIndex() const { return rowind; }
+    const IntArray &giveColPtr() const { return colptr; }
 
     // Methods needed by SuperLU interface
     const int giveNumberOfNonzeros() {return nz;}
@@ -112,6 +132,11 @@ protected:
     double operator() (int i, int j) const;
     /// implements 0-based access
     double &operator() (int i, int j);
+
+    /// Returns true if the products should be computed in parallel by rows.
+    bool useRowAccess() const;
+    /// Builds the row access to the stored entries (entries of each row ordered by columns), unless it is valid.
+    void buildRowAccess() const;
 };
 } // end namespace oofem
 #endif // compcol_h
@@ -36,6 +36,10 @@ private:
     std::vector< IntArray > nodalConnectivity;
     /// Flag indicating assembled connectivity table for domain.
     int nodalConnectivityFlag;
+    /// Element colouring; elements of the same colour share no dof managers.
+    std::vector< IntArray > elementColouring;
+    /// Flag indicating valid element colouring.
+    int elementColouringFlag;
 #ifdef _OPENMP
     omp_lock_t initLock;
 #endif
@@ -74,6 +78,13 @@ public:
      * @param nodeList List of nodes, which neighborhood is searched.
      */
     void giveNodeNeighbourList(IntArray &answer, IntArray &nodeList);
+    /**
+     * Returns the element colouring of the domain. Each entry is the list of elements of one colour.
+     * Elements of the same colour share no dof manager (master dof managers of slave dofs are taken
+     * into account), so their contributions can be scattered into global matrices concurrently without locks.
+     * The colouring is computed by greedy algorithm on first request and cached until reset.
+     */
+    const std::vector< IntArray > &giveElementColouring();
 };
 } // end namespace oofem
 #endif // conTable_h
@@ -7,6 +7,7 @@
 
 #include "oofemcfg.h"
 #include "input/domaintype.h"
+#include "mesher/spatiallocalizertype.h"
 #include "utility/statecountertype.h"
 #include "math/intarray.h"
 #include "error/error.h"
@@ -18,6 +19,7 @@
 #include <memory>
 #include <unordered_map>
 #include <map>
+#include <mutex>
 #include <string>
 #include <list>
 
@@ -39,6 +41,7 @@
 #define _IFT_Domain_numberOfSpatialDimensions "nsd" ///< [in,optional] Specifies how many spatial dimensions the domain has.
 #define _IFT_Domain_nfracman "nfracman" /// [in,optional] Specifies if there is a fracture manager.
 #define _IFT_Domain_axisymmetric "axisymm" /// [optional] Specifies if the problem is axisymmetric.
+#define _IFT_Domain_spatialLocalizer "localizer" /// [optional] Type of spatial localizer (see SpatialLocalizerType).
 //@}
 
 namespace oofem {
@@ -67,6 +70,7 @@ class Set;
 class FractureManager;
 class ProcessCommunicator;
 class ContactManager;
+class MaterialStatusArena;
 /**
  * Class and object Domain. Domain contains mesh description, or if program runs in parallel then it contains
  * description of domain associated to particular processor or thread of execution. Generally, it contain and
@@ -131,6 +135,8 @@ private:
      * Provides the spatial localization services.
      */
     std :: unique_ptr< SpatialLocalizer > spatialLocalizer;
+    /// Type of spatial localizer created during post-initialization.
+    SpatialLocalizerType spatialLocalizerType;
     /// Output manager, allowing to filter the produced output.
     std :: unique_ptr< OutputManager > outputManager;
     /// Domain number.
@@ -189,6 +195,10 @@ private:
     /// Topology description
     std :: unique_ptr< TopologyDescription > topology;
 
+    /// Arenas for integration point statuses, indexed by region (cross section) and material number.
+    std :: map< std :: pair< int, int >, MaterialStatusArena * >statusArenas;
+    std :: mutex statusArenaMutex;
+
 public:
     /// Keeps track of next free dof ID (for special Lagrange multipliers, XFEM and such)
     int freeDofID;
@@ -596,6 +606,15 @@ public:
     * Set spatial localizer
     */
     void setSpatialLocalizer(std::unique_ptr<SpatialLocalizer> sl);
+    /**
+     * Returns the arena for integration point statuses of elements in given region with given material.
+     * The arena is created on first request.
+     * @param region Region (cross section) number.
+     * @param material Material number.
+     */
+    MaterialStatusArena *giveMaterialStatusArena(int region, int material);
+    /// Returns memory used by integration point statuses allocated in arenas of receiver, in bytes.
+    std :: size_t giveMaterialStatusMemoryUsage();
     /**
      * Returns domain output manager.
      */
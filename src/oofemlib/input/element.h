@@ -608,6 +608,8 @@ public:
     int giveMaterialNumber() const {return material;}
     /// @return Reference to the associated crossSection of element.
     CrossSection *giveCrossSection();
+    /// @return Cross section number.
+    int giveCrossSectionNumber() const { return crossSection; }
 
 
     /**
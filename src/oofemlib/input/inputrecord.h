@@ -71,6 +71,8 @@ public:
 
     /// Returns string representation of record in OOFEMs text format.
     virtual std :: string giveRecordAsString() const = 0;
+    /// Returns the name of the source (file) the record was read from, empty if unknown.
+    virtual std :: string giveSourceName() const { return std :: string(); }
 
     /**@name Compulsory field extraction methods
      * Reads the field value identified by keyword
@@ -153,6 +155,8 @@ public:
     std::string record;
     std::string keyword;
     int number;
+    /// Source of the record (file name), empty if unknown.
+    std::string source;
     InputException(const InputRecord &ir, std::string keyword, int number);
 };
 
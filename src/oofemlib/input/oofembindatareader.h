@@ -0,0 +1,153 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef oofembindatareader_h
+#define oofembindatareader_h
+
+#include "input/datareader.h"
+#include "input/oofembininputrecord.h"
+#include "input/oofemtxtinputrecord.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace oofem {
+/**
+ * Data reader for binary input files.
+ * The binary file keeps the records of the text input in the same order, but nodes, elements and sets are stored in
+ * contiguous typed blocks (coordinates, connectivity, per-element attributes, set lists), which are memory-mapped and
+ * served by OOFEMBinaryInputRecord without any text parsing. All other records (and nodes, elements or sets with
+ * fields that have no typed block) are stored as text and read as OOFEMTXTInputRecord.
+ *
+ * Binary files are created from text input files by convert (the -b option of the executable). They are meant
+ * for large meshes, where tokenizing the node and element records dominates the time needed to read the input.
+ * The file is written in the native byte order and is not portable between platforms of different endianness.
+ */
+class OOFEM_EXPORT OOFEMBinaryDataReader : public DataReader
+{
+public:
+    /// Blocks of the binary file.
+    enum Block {
+        B_Entries,        ///< Sequence of records, pairs (kind, index) of int32.
+        B_StringOffsets,  ///< Offsets of strings in B_Chars (uint64, number of strings + 1).
+        B_StringLines,    ///< Line numbers of text records in the original input (int32 per string).
+        B_Chars,          ///< Characters of strings.
+        B_NodeType,       ///< Type name of nodes, index into strings (int32).
+        B_NodeLabel,      ///< Node labels (int32).
+        B_NodeNCoords,    ///< Number of node coordinates (int32).
+        B_NodeCoords,     ///< Node coordinates (3 doubles per node).
+        B_ElemType,       ///< Type name of elements, index into strings (int32).
+        B_ElemLabel,      ///< Element labels (int32).
+        B_ElemMat,        ///< Element materials, 0 if not given (int32).
+        B_ElemCrossSect,  ///< Element cross sections, 0 if not given (int32).
+        B_ConnOffsets,    ///< Offsets of element nodes in B_Conn (uint64, number of elements + 1).
+        B_Conn,           ///< Element nodes (int32).
+        B_SetLabel,       ///< Set labels (int32).
+        B_SetListOffsets, ///< Offsets of set lists in B_SetLists (uint64, SL_Count per set + 1).
+        B_SetLists,       ///< Set lists (int32, ranges are stored as pairs).
+        B_Count
+    };
+
+    /// Lists stored for every set.
+    enum SetList {
+        SL_Nodes, SL_NodeRanges, SL_Elements, SL_ElementRanges, SL_ElementBoundaries, SL_ElementEdges, SL_ElementSurfaces,
+        SL_Count
+    };
+
+    /// Kind of text record in B_Entries, the other kinds are given by OOFEMBinaryInputRecord :: RecordKind.
+    static constexpr int RK_Text = 0;
+    /// Index of the first type name in strings (output file name and description are first).
+    static constexpr int firstTypeString = 2;
+
+    /// Header of the binary file.
+    struct FileHeader {
+        char magic [ 8 ];
+        std :: uint32_t version;
+        /// Value of byteOrderMark written in the byte order of the writer.
+        std :: uint32_t byteOrder;
+        std :: uint64_t nEntries, nStrings, nTypes, nNodes, nElements, nSets;
+        std :: uint64_t offset [ B_Count ];
+        std :: uint64_t size [ B_Count ];
+    };
+
+    static constexpr std :: uint32_t fileVersion = 1;
+    static constexpr std :: uint32_t byteOrderMark = 0x01020304;
+
+protected:
+    std :: string dataSourceName;
+    /// Contents of the file (mapped, or read into buffer if mapping is not available).
+    const char *data;
+    std :: size_t dataSize;
+    bool mapped;
+    std :: vector< char >buffer;
+
+    const FileHeader *header;
+    const std :: int32_t *entries;
+    const std :: uint64_t *stringOffsets;
+    const std :: int32_t *stringLines;
+    const char *chars;
+    const std :: int32_t *nodeType, *nodeLabel, *nodeNCoords;
+    const double *nodeCoords;
+    const std :: int32_t *elemType, *elemLabel, *elemMat, *elemCrossSect;
+    const std :: uint64_t *connOffsets;
+    const std :: int32_t *conn;
+    const std :: int32_t *setLabel;
+    const std :: uint64_t *setListOffsets;
+    const std :: int32_t *setLists;
+
+    /// Current position in the sequence of records.
+    std :: size_t position;
+    /// Record reused for the records in typed blocks.
+    OOFEMBinaryInputRecord record;
+    /// Text records, created on first access.
+    std :: vector< std :: unique_ptr< OOFEMTXTInputRecord > >textRecords;
+
+    friend class OOFEMBinaryInputRecord;
+
+public:
+    /// Constructor, maps the given file.
+    OOFEMBinaryDataReader(std :: string inputfilename);
+    OOFEMBinaryDataReader(const OOFEMBinaryDataReader &) = delete;
+    OOFEMBinaryDataReader &operator = ( const OOFEMBinaryDataReader & ) = delete;
+    virtual ~OOFEMBinaryDataReader();
+
+    /**
+     * Returns input record corresponding to the next record.
+     * The records of nodes, elements and sets are valid only until the next call.
+     */
+    InputRecord &giveInputRecord(InputRecordType, int recordId) override;
+    bool peakNext(const std :: string &keyword) override;
+    void finish() override;
+    std :: string giveReferenceName() const override { return dataSourceName; }
+
+    /// Returns the number of records stored in typed blocks as nodes, elements and sets.
+    int giveNumberOfNodeRecords() const { return ( int ) header->nNodes; }
+    int giveNumberOfElementRecords() const { return ( int ) header->nElements; }
+    int giveNumberOfSetRecords() const { return ( int ) header->nSets; }
+
+    /// Returns true if the given file is a binary input file.
+    static bool isBinaryFile(const std :: string &fileName);
+    /**
+     * Converts text input file to binary input file.
+     * Node, element and set records containing only fields with typed blocks are stored in the blocks,
+     * the remaining records are stored as text.
+     * @param inputFileName Name of the text input file (included files are resolved).
+     * @param outputFileName Name of the binary file.
+     */
+    static void convert(const std :: string &inputFileName, const std :: string &outputFileName);
+
+protected:
+    /// Returns the i-th string.
+    std :: string giveString(std :: size_t i) const;
+    /// Returns the list of set (pointer to the first value and the number of values).
+    const std :: int32_t *giveSetList(int set, SetList list, int &size) const;
+    /// Sets the pointers to blocks, checks the header.
+    void mapBlocks();
+    /// Returns the text record for given string, creates it on first access.
+    OOFEMTXTInputRecord &giveTextRecord(std :: size_t i);
+};
+} // end namespace oofem
+#endif // oofembindatareader_h
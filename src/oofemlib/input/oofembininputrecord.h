@@ -0,0 +1,73 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef oofembininputrecord_h
+#define oofembininputrecord_h
+
+#include "input/inputrecord.h"
+
+#include <string>
+
+namespace oofem {
+class OOFEMBinaryDataReader;
+
+/**
+ * Input record of a node, element or set stored in the typed blocks of a binary input file (see OOFEMBinaryDataReader).
+ * The fields are served directly from the (memory-mapped) blocks, no text is parsed. Only the fields stored in the
+ * typed blocks are present: coordinates of nodes; connectivity, material and cross section of elements; node and
+ * element lists and ranges and element boundaries, edges and surfaces of sets.
+ * The receiver is reused by the reader for all typed records.
+ */
+class OOFEM_EXPORT OOFEMBinaryInputRecord : public InputRecord
+{
+public:
+    /// Kind of the record, determines the block it is stored in.
+    enum RecordKind { RK_Node = 1, RK_Element = 2, RK_Set = 3 };
+
+protected:
+    const OOFEMBinaryDataReader *reader;
+    RecordKind kind;
+    /// Index of the record in its block (0-based).
+    int index;
+    /// Bit mask of read fields (bit 0 is the record keyword).
+    int readFlags;
+
+public:
+    OOFEMBinaryInputRecord(const OOFEMBinaryDataReader *reader, RecordKind kind = RK_Node, int index = 0);
+
+    std :: unique_ptr< InputRecord >clone() const override { return std :: make_unique< OOFEMBinaryInputRecord >(* this); }
+
+    /// Sets the record to be served by the receiver.
+    void setRecord(RecordKind kind, int index);
+    /// Returns the keyword (type name) of the record.
+    const char *giveKeyword() const;
+
+    std :: string giveRecordAsString() const override;
+    void finish(bool wrn = true) override;
+
+    void giveRecordKeywordField(std :: string &answer, int &value) override;
+    void giveRecordKeywordField(std :: string &answer) override;
+    void giveField(int &answer, InputFieldType id) override;
+    void giveField(double &answer, InputFieldType id) override;
+    void giveField(bool &answer, InputFieldType id) override;
+    void giveField(std :: string &answer, InputFieldType id) override;
+    void giveField(FloatArray &answer, InputFieldType id) override;
+    void giveField(IntArray &answer, InputFieldType id) override;
+    void giveField(FloatMatrix &answer, InputFieldType id) override;
+    void giveField(std :: vector< std :: string > &answer, InputFieldType id) override;
+    void giveField(Dictionary &answer, InputFieldType id) override;
+    void giveField(std :: list< Range > &answer, InputFieldType id) override;
+    void giveField(ScalarFunction &answer, InputFieldType id) override;
+
+    bool hasField(InputFieldType id) override;
+    void printYourself() override;
+
+protected:
+    /// Returns the index of field in the field table of the record kind, or -1 if the record does not contain it.
+    int giveFieldIndx(InputFieldType id) const;
+    /// Throws the exception for a field which is missing or can not be given as requested type.
+    [[noreturn]] void throwFieldError(InputFieldType id) const;
+};
+} // end namespace oofem
+#endif // oofembininputrecord_h
@@ -9,6 +9,8 @@
 #include "input/oofemtxtinputrecord.h"
 
 #include <fstream>
+#include <vector>
+#include <memory>
 
 namespace oofem {
 /**
@@ -23,14 +25,22 @@ class OOFEM_EXPORT OOFEMTXTDataReader : public DataReader
 {
 protected:
     std :: string dataSourceName;
-    std :: list< OOFEMTXTInputRecord > recordList;
+    std :: vector< OOFEMTXTInputRecord > recordList;
 
     /// Keeps track of the current position in the list
-    std :: list< OOFEMTXTInputRecord > :: iterator it;
+    std :: vector< OOFEMTXTInputRecord > :: iterator it;
+
+    /// Line of input, before tokenizing.
+    struct InputLine {
+        int number;
+        std :: shared_ptr< const std :: string >source;
+        std :: string text;
+    };
 
 public:
     /// Constructor.
     OOFEMTXTDataReader(std :: string inputfilename);
+    /// Copies the records of x (without reading the file again), the copy starts at the first record.
     OOFEMTXTDataReader(const OOFEMTXTDataReader & x);
     virtual ~OOFEMTXTDataReader();
 
@@ -38,8 +48,17 @@ public:
     bool peakNext(const std :: string &keyword) override;
     void finish() override;
     std :: string giveReferenceName() const override { return dataSourceName; }
+    /// Returns true if there are unread records.
+    bool hasNext() const { return this->it != this->recordList.end(); }
 
 protected:
+    /**
+     * Reads all lines of given file, included files (@include "somefile") are read recursively in place of the include line.
+     * @param fileName Name of the file.
+     * @param lines Lines are appended to this list.
+     * @param depth Depth of inclusion (0 for the main input file, which starts with output file name and description).
+     */
+    void readInputFile(const std :: string &fileName, std :: vector< InputLine > &lines, int depth);
     /**
      * Reads one line from inputStream
      * Parts within quotations have case preserved.
@@ -10,6 +10,7 @@
 
 #include <string>
 #include <vector>
+#include <memory>
 
 namespace oofem {
 /**
@@ -26,21 +27,24 @@ protected:
      */
     Tokenizer tokenizer;
     std :: vector< bool >readFlag;
+    /**
+     * Indices of tokens which can be keywords (tokens not starting like a number), in record order.
+     * Keywords are looked up in this index only, so that the numbers of long lists are not scanned.
+     */
+    std :: vector< int >keywordTokens;
 
     /// Record representation.
     std :: string record;
 
     int lineNumber;
+    /// Name of the file the record was read from (shared by all records of the file).
+    std :: shared_ptr< const std :: string >sourceName;
 
 public:
     /// Constructor. Creates an empty input record.
     OOFEMTXTInputRecord();
     /// Constructor. Creates the input record corresponding to given string.
     OOFEMTXTInputRecord(int linenumber, std :: string source);
-    /// Copy constructor.
-    OOFEMTXTInputRecord(const OOFEMTXTInputRecord &);
-    /// Assignment operator.
-    OOFEMTXTInputRecord &operator = ( const OOFEMTXTInputRecord & );
 
     std::unique_ptr<InputRecord> clone() const override { return std::make_unique<OOFEMTXTInputRecord>(*this); }
 
@@ -49,6 +53,7 @@ public:
     void setRecordString(std :: string newStr);
     /// Returns record string.
     std :: string giveRecordAsString() const override { return this->record; }
+    std :: string giveSourceName() const override { return sourceName ? * sourceName : std :: string(); }
 
     void finish(bool wrn = true) override;
 
@@ -71,9 +76,13 @@ public:
     void printYourself() override;
 
     void setLineNumber(int lineNumber) { this->lineNumber = lineNumber; }
+    int giveLineNumber() const { return this->lineNumber; }
+    void setSourceName(std :: shared_ptr< const std :: string >name) { this->sourceName = std :: move(name); }
 
 protected:
     int giveKeywordIndx(const char *kwd);
+    /// Tokenizes the record and builds the keyword index.
+    void tokenizeRecord();
     const char *scanInteger(const char *source, int &value);
     const char *scanDouble(const char *source, double &value);
     void setReadFlag(int itok) { readFlag [ itok - 1 ] = true; }
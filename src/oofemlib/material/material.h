@@ -33,6 +33,7 @@ class FloatArray;
 class FloatMatrix;
 class Element;
 class ProcessCommunicator;
+class MaterialStatusArena;
 
 /**
  * Abstract base class for all material models. Declares the basic common interface
@@ -301,6 +302,12 @@ public:
      */
     virtual MaterialStatus *CreateStatus(GaussPoint *gp) const
     { return nullptr; }
+    /**
+     * Returns the arena where the status of given integration point is allocated,
+     * one arena is used for integration points of each element region and material.
+     * @return Arena or null if statuses are allocated on the heap.
+     */
+    MaterialStatusArena *giveStatusArena(GaussPoint *gp) const;
 
     /**
      * Initializes temporary variables stored in integration point status
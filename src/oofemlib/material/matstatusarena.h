@@ -0,0 +1,101 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef matstatusarena_h
+#define matstatusarena_h
+
+#include "oofemcfg.h"
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+namespace oofem {
+/**
+ * Arena allocator for integration point (material) statuses.
+ * Statuses are allocated from large chunks instead of individually from the heap, so that the statuses of one
+ * element set and material lie next to each other in memory and millions of small allocations are avoided.
+ * Freed blocks are kept in free lists (one per block size) and reused by later allocations.
+ *
+ * The arenas are owned by the domain (see Domain :: giveMaterialStatusArena), the allocation itself is done by
+ * IntegrationPointStatus :: operator new, which uses the arena activated by MaterialStatusArena :: Scope in the
+ * calling thread (or the heap if there is none). Every block remembers its arena, so the statuses may be deleted
+ * in any order, and also after the owner released the arena; the arena is destroyed when it has been released
+ * and its last block has been freed.
+ */
+class OOFEM_EXPORT MaterialStatusArena
+{
+protected:
+    /// Allocated chunks.
+    std :: vector< std :: unique_ptr< char[] > >chunks;
+    /// Free part of the last chunk.
+    char *cursor;
+    std :: size_t left;
+    /// Heads of free lists, indexed by block size in units of alignment.
+    std :: vector< void * >freeLists;
+    /// Number of allocated blocks.
+    std :: size_t nBlocks;
+    /// Bytes in allocated blocks.
+    std :: size_t usedBytes;
+    /// Set when the owner released the receiver.
+    bool released;
+    std :: mutex mutex;
+
+    /// Alignment and granularity of blocks.
+    static constexpr std :: size_t alignment = alignof( std :: max_align_t );
+    /// Size of chunks.
+    static constexpr std :: size_t chunkSize = 256 * 1024;
+
+    /// Arena used by allocations in current thread.
+    static thread_local MaterialStatusArena *current;
+
+    MaterialStatusArena();
+    ~MaterialStatusArena() = default;
+
+public:
+    MaterialStatusArena(const MaterialStatusArena &) = delete;
+    MaterialStatusArena &operator=(const MaterialStatusArena &) = delete;
+
+    /// Creates new arena, the caller becomes its owner.
+    static MaterialStatusArena *create() { return new MaterialStatusArena(); }
+    /// Gives up the ownership, the receiver is deleted as soon as all its blocks are freed.
+    void release();
+
+    /**
+     * Allocates memory for an object of given size, from the arena active in the current thread, or from the heap.
+     * The block must be freed by deallocate.
+     */
+    static void *allocate(std :: size_t size);
+    /// Frees block obtained from allocate, size must be the same as in allocation.
+    static void deallocate(void *ptr, std :: size_t size);
+
+    /// Returns the number of allocated blocks.
+    std :: size_t giveNumberOfBlocks() const { return nBlocks; }
+    /// Returns the memory in use by allocated blocks in bytes.
+    std :: size_t giveUsedMemory() const { return usedBytes; }
+    /// Returns the memory reserved by the receiver in bytes.
+    std :: size_t giveReservedMemory() const;
+
+    /**
+     * Activates an arena in the current thread for the lifetime of the receiver, the previously active arena is
+     * restored on destruction. A null arena means that the heap is used.
+     */
+    class Scope
+    {
+        MaterialStatusArena *previous;
+    public:
+        Scope(MaterialStatusArena *arena) : previous(current) { current = arena; }
+        ~Scope() { current = previous; }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+
+protected:
+    void *giveBlock(std :: size_t size);
+    /// Returns the block to free list, returns true if the receiver should be deleted.
+    bool freeBlock(void *ptr, std :: size_t size);
+};
+} // end namespace oofem
+#endif // matstatusarena_h
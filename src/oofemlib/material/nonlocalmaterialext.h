@@ -11,9 +11,13 @@
 #include "math/grid.h"
 #include "math/mathfem.h"
 #include "input/dynamicinputrecord.h"
+#include "utility/statecountertype.h"
 
 #include <list>
 #include <memory>
+#include <vector>
+#include <mutex>
+#include <atomic>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -38,6 +42,7 @@
 #define _IFT_NonlocalMaterialExtensionInterface_initdiag "initdiag"
 #define _IFT_NonlocalMaterialExtensionInterface_order "order"
 #define _IFT_NonlocalMaterialExtensionInterface_centdiff "centdiff"
+#define _IFT_NonlocalMaterialExtensionInterface_interactionTable "nltable"
 //@}
 
 namespace oofem {
@@ -54,6 +59,161 @@ struct localIntegrationRecord {
     double weight;
 };
 
+/**
+ * Nonlocal interaction table of all integration points of one material, stored in compressed row format.
+ * The row of an integration point holds its localIntegrationRecords, its integration scale and the volume around it.
+ * The rows are ordered by elements and by integration points of their default integration rules.
+ * Single rows can be replaced; a row is overwritten in place if the new one fits into it,
+ * otherwise it is moved to the end of the record array. The records are compacted once the unused space
+ * exceeds the used one.
+ */
+class OOFEM_EXPORT NonlocalInteractionTable
+{
+protected:
+    /// Records of all rows.
+    std :: vector< localIntegrationRecord >records;
+    /// Position, size and capacity of rows in records.
+    std :: vector< std :: size_t >rowBegin;
+    std :: vector< int >rowSize, rowCapacity;
+    /// Integration scale and volume around of rows.
+    std :: vector< double >rowScale, rowVolume;
+    /// Rows of element e are elementRowPtr[e-1], ..., elementRowPtr[e]-1.
+    std :: vector< int >elementRowPtr;
+    /// Integration point of each row.
+    std :: vector< GaussPoint * >rowPoints;
+    /// Number of unused records.
+    std :: size_t unused = 0;
+    /**
+     * Column of each record (at the same position as the record), i.e., the row of its point,
+     * or nrows + i for the i-th point not in the table. Built on demand.
+     */
+    std :: vector< int >columns;
+    /// Points of records which are not in the table.
+    std :: vector< GaussPoint * >externalPoints;
+    bool columnsValid = false;
+
+public:
+    NonlocalInteractionTable() { }
+
+    /**
+     * Initializes the rows (without records).
+     * @param nrows Number of rows of each element (zero for elements not in the table).
+     * @param d Domain of the elements.
+     */
+    void setElementRows(const std :: vector< int > &nrows, Domain *d);
+    /**
+     * Sets all records at once.
+     * @param size Number of records of each row.
+     * @param copyRow Function copying records of given row to given position.
+     */
+    template< class CopyRow >void assemble(const std :: vector< int > &size, CopyRow copyRow);
+    /// Replaces the records of given row.
+    void setRow(int row, const std :: vector< localIntegrationRecord > &rec, double scale, double volume);
+
+    int giveNumberOfRows() const { return ( int ) rowSize.size(); }
+    /// Returns the row of given element integration point, -1 if it is not in the table.
+    int giveRow(GaussPoint *gp) const;
+    /// Returns the rows of given element.
+    int giveFirstRow(int elem) const { return elementRowPtr [ elem - 1 ]; }
+    int giveNumberOfRows(int elem) const { return elementRowPtr [ elem ] - elementRowPtr [ elem - 1 ]; }
+    localIntegrationRecord *giveRecords(int row) { return records.data() + rowBegin [ row ]; }
+    /// Returns all records, records of a row start at giveRowBegin.
+    const localIntegrationRecord *giveRecords() const { return records.data(); }
+    std :: size_t giveRowBegin(int row) const { return rowBegin [ row ]; }
+    int giveRowSize(int row) const { return rowSize [ row ]; }
+    double giveIntegrationScale(int row) const { return rowScale [ row ]; }
+    void setIntegrationScale(int row, double val) { rowScale [ row ] = val; }
+    double giveVolumeAround(int row) const { return rowVolume [ row ]; }
+    void setRowData(int row, double scale, double volume) { rowScale [ row ] = scale; rowVolume [ row ] = volume; }
+    GaussPoint *giveRowPoint(int row) const { return rowPoints [ row ]; }
+    /// Returns the columns of records (see columns), building them if necessary.
+    const std :: vector< int > &giveColumns();
+    /// Returns the points of records not in the table, in the order of their columns.
+    const std :: vector< GaussPoint * > &giveExternalPoints() { this->giveColumns(); return externalPoints; }
+    /// Returns the total number of records.
+    std :: size_t giveNumberOfRecords() const { return records.size() - unused; }
+    /**
+     * Checks that the rows fit into the record array without overlapping and that the number of unused records
+     * is equal to the number of records outside the rows. Reports an error otherwise.
+     */
+    void checkConsistency() const;
+
+protected:
+    /// Removes unused records.
+    void compact();
+};
+
+template< class CopyRow >
+void NonlocalInteractionTable :: assemble(const std :: vector< int > &size, CopyRow copyRow)
+{
+    int nrows = this->giveNumberOfRows();
+    std :: size_t n = 0;
+    for ( int i = 0; i < nrows; i++ ) {
+        rowBegin [ i ] = n;
+        rowSize [ i ] = rowCapacity [ i ] = size [ i ];
+        n += size [ i ];
+    }
+    records.resize(n);
+    records.shrink_to_fit();
+    unused = 0;
+    columnsValid = false;
+#ifdef _OPENMP
+ #pragma omp parallel for schedule(static)
+#endif
+    for ( int i = 0; i < nrows; i++ ) {
+        copyRow(i, records.data() + rowBegin [ i ]);
+    }
+}
+
+
+/**
+ * Integration list of an integration point, i.e., the list of localIntegrationRecords.
+ * The records are either owned by the list, or the list refers to a row of NonlocalInteractionTable.
+ * Provides the subset of std::vector services used by nonlocal models.
+ */
+class OOFEM_EXPORT NonlocalIntegrationList
+{
+protected:
+    /// Own records.
+    std :: vector< localIntegrationRecord >records;
+    /// Table containing the records (null if the records are owned) and the row in it.
+    NonlocalInteractionTable *table = nullptr;
+    int row = -1;
+
+public:
+    typedef localIntegrationRecord *iterator;
+    typedef const localIntegrationRecord *const_iterator;
+
+    iterator begin() { return table ? table->giveRecords(row) : records.data(); }
+    iterator end() { return begin() + size(); }
+    std :: size_t size() const { return table ? table->giveRowSize(row) : records.size(); }
+    bool empty() const { return size() == 0; }
+    localIntegrationRecord &operator[](std :: size_t i) { return begin() [ i ]; }
+
+    void clear() { records.clear(); table = nullptr; row = -1; }
+    void reserve(std :: size_t n) { detach(); records.reserve(n); }
+    void push_back(const localIntegrationRecord &r) { detach(); records.push_back(r); }
+    void shrink_to_fit() { records.shrink_to_fit(); }
+    /// Sets own records.
+    void setRecords(std :: vector< localIntegrationRecord > &&r) { table = nullptr; row = -1; records = std :: move(r); }
+    /// Makes the list refer to given row of the table.
+    void setTableRow(NonlocalInteractionTable *t, int r) { records.clear(); records.shrink_to_fit(); table = t; row = r; }
+    /// Returns the table containing the records, null if the records are owned.
+    NonlocalInteractionTable *giveTable() const { return table; }
+    int giveTableRow() const { return row; }
+
+protected:
+    /// Copies the records from the table row.
+    void detach() {
+        if ( table ) {
+            records.assign(table->giveRecords(row), table->giveRecords(row) + table->giveRowSize(row) );
+            table = nullptr;
+            row = -1;
+        }
+    }
+};
+
+
   enum WeightFunctionType {
                            WFT_Unknown,
                            WFT_Bell,
@@ -82,7 +242,7 @@ class OOFEM_EXPORT NonlocalMaterialStatusExtensionInterface : public Interface
 {
 protected:
     /// List containing localIntegrationRecord values.
-    std :: vector< localIntegrationRecord >integrationDomainList;
+    NonlocalIntegrationList integrationDomainList;
     /// Nonlocal volume around the corresponding integration point.
     double integrationScale;
     /// Local volume around the corresponding integration point.
@@ -102,11 +262,20 @@ public:
      * references to integration points and their weights that influence the nonlocal average in
      * receiver's associated integration point.
      */
-    std :: vector< localIntegrationRecord > *giveIntegrationDomainList() { return & integrationDomainList; }
+    NonlocalIntegrationList *giveIntegrationDomainList() { return & integrationDomainList; }
     /// Returns associated integration scale.
-    double giveIntegrationScale() { return integrationScale; }
+    double giveIntegrationScale() {
+        auto table = integrationDomainList.giveTable();
+        return table ? table->giveIntegrationScale( integrationDomainList.giveTableRow() ) : integrationScale;
+    }
     /// Sets associated integration scale.
-    void setIntegrationScale(double val) { integrationScale = val; }
+    void setIntegrationScale(double val) {
+        if ( auto table = integrationDomainList.giveTable() ) {
+            table->setIntegrationScale(integrationDomainList.giveTableRow(), val);
+        } else {
+            integrationScale = val;
+        }
+    }
     /// Returns associated volume.
     double giveVolumeAround() { return volumeAround; }
     /// Sets associated integration scale.
@@ -166,6 +335,29 @@ protected:
     int order = 0;
     int centDiff = 0;
 
+    /**
+     * Flag indicating whether the interaction tables of all integration points of the material are built at once
+     * (in parallel) and stored in one NonlocalInteractionTable instead of per point lists.
+     * Used only with bounded support and permanent tables. The table gives the same averages as the per point lists.
+     */
+    bool interactionTableFlag = false;
+    /// Interaction table of the material, built on demand.
+    mutable std :: unique_ptr< NonlocalInteractionTable >interactionTable;
+    mutable std :: atomic< bool >interactionTableBuilt;
+    mutable std :: mutex interactionTableMutex;
+    /**
+     * Elements which are not activated in the current step and the state the activity was checked for.
+     * Inactive elements do not contribute to the averages, the interaction table or the permanent lists
+     * of points near the elements are updated when the activity of elements changes.
+     */
+    mutable std :: vector< char >inactiveElements;
+    mutable std :: atomic< StateCounterType >activityStateCounter;
+    mutable std :: mutex activityMutex;
+    /// Nonlocal averages of the local variable for the rows of the interaction table and the state they were computed for.
+    mutable std :: vector< double >nonlocalAverages;
+    mutable std :: atomic< StateCounterType >nonlocalAveragesStateCounter;
+    mutable std :: mutex nonlocalAveragesMutex;
+
     /**
      * Characteristic length of the nonlocal model
      * (its interpretation depends on the type of weight function).
@@ -279,9 +471,53 @@ public:
      * if contributingElems param is not NULL, then it is assumed that it contains
      * a <em>complete</em> list of elements contributing to receiver. If equal to NULL
      * existing list is cleared and  buildNonlocalPointTable service is invoked.
+     * If the list is a row of the material interaction table, the row is replaced;
+     * the table must not be accessed concurrently in that case.
      */
     void rebuildNonlocalPointTable(GaussPoint *gp, IntArray *contributingElems) const;
 
+    /**
+     * Returns the interaction table of the material, building it if necessary.
+     * The table is built for the points of default integration rules of all elements of the material;
+     * the points are processed in parallel.
+     * @return Table or null if the material does not use it (see interactionTableFlag).
+     */
+    NonlocalInteractionTable *giveNonlocalInteractionTable() const;
+    /**
+     * Updates the interaction table after the given elements have been changed (e.g., their geometry or barriers).
+     * Only the rows of points within the support radius of the integration points of these elements
+     * and the rows referring to them are recomputed, in parallel.
+     * Nothing is done if the table has not been built yet.
+     */
+    void updateNonlocalInteractionTable(const IntArray &changedElements) const;
+    /**
+     * Checks the activity of elements in given solution step. If it has changed, the interaction table is updated,
+     * or the permanent lists of points near the changed elements are cleared (and rebuilt when needed).
+     * Called from updateDomainBeforeNonlocAverage, the check is done once per solution state.
+     */
+    void updateElementActivity(TimeStep *tStep) const;
+
+    /**
+     * Returns true if the material averages a single scalar variable, which is provided by giveLocalVariableForAverage,
+     * with the weights kept in the interaction table (i.e., the weights are not modified during the averaging).
+     * Such materials may use giveNonlocalAverage instead of looping over the integration list of each point.
+     */
+    virtual bool hasNonlocalAveragingKernel() const { return false; }
+    /// Returns the local variable of given point, which is averaged by giveNonlocalAverage.
+    virtual double giveLocalVariableForAverage(GaussPoint *gp) const;
+    /**
+     * Computes the weighted sum of local variables over the integration list of given point (not scaled by the integration scale).
+     * When first called in a solution state, the local variables of all points are gathered into one array
+     * and the sums of all points of the material are evaluated as a sparse matrix-vector product with the interaction table, in parallel.
+     * Must be called after updateDomainBeforeNonlocAverage.
+     * @param answer Weighted sum.
+     * @param gp Integration point.
+     * @param tStep Time step.
+     * @return False if the sum is not available (the material does not use the kernel or the interaction table, or the point
+     * is not in the table), the caller has to evaluate it from the integration list then.
+     */
+    bool giveNonlocalAverage(double &answer, GaussPoint *gp, TimeStep *tStep) const;
+
     /**
      * Recompute the nonlocal interaction weights based on the current solution (e.g., on the damage field).
      * This method is used e.g. by eikonal nonlocal damage models.
@@ -315,7 +551,7 @@ public:
      * receiver's associated integration point.
      * Rebuilds the IP list by calling  buildNonlocalPointTable if not available.
      */
-    std :: vector< localIntegrationRecord > *giveIPIntegrationList(GaussPoint *gp) const;
+    NonlocalIntegrationList *giveIPIntegrationList(GaussPoint *gp) const;
 
     /**
      * Evaluates the basic nonlocal weight function for a given distance
@@ -405,6 +641,27 @@ protected:
 
     void applyBarrierConstraints(const FloatArray &gpCoords, const FloatArray &jGpCoords, double &weight) const;
 
+    /**
+     * Computes the records of integration points influencing given point and appends them to answer.
+     * @param answer Records.
+     * @param gp Receiver point.
+     * @param contributingElems Complete list of contributing elements; if null, the elements within the support
+     * are found by the spatial localizer.
+     * @return Integration scale, i.e., the sum of weights of the records.
+     */
+    double giveNonlocalPointRecords(std :: vector< localIntegrationRecord > &answer, GaussPoint *gp, const IntArray *contributingElems) const;
+    /**
+     * Marks the elements with integration points within the support of integration points of given elements
+     * (the support of a point never exceeds the default one, periodic images are taken into account).
+     * @param answer Flags of elements, indexed from 1, the given elements are marked too.
+     * @param elements Elements.
+     */
+    void giveElementsNearElements(std :: vector< char > &answer, const IntArray &elements) const;
+    /// Builds the interaction table of the material.
+    void buildNonlocalInteractionTable() const;
+    /// Computes nonlocalAverages for all rows of the interaction table.
+    void computeNonlocalAverages(NonlocalInteractionTable &table) const;
+
     /**
      * Manipulates weight on integration point in the element.
      * By default is off, keyword 'averagingtype' specifies various methods.
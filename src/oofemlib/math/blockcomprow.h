@@ -0,0 +1,88 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef blockcomprow_h
+#define blockcomprow_h
+
+#include "math/sparsemtrx.h"
+#include "math/floatarray.h"
+
+#include <vector>
+
+#define _IFT_BlockCompRow_Name "bcsr"
+
+namespace oofem {
+/**
+ * Sparse matrix stored in block compressed row format.
+ * The equations of each dof manager form one block (equations not belonging to any dof manager form single blocks),
+ * all blocks have the same size given by the largest number of equations of dof manager (3x3 for solids, 6x6 for
+ * shells) and they are stored as dense row-major matrices; smaller blocks are padded with zeros.
+ * Compared to the scalar formats, one column index is stored per block, and the products work on small dense blocks
+ * with fixed size (vectorized), the block rows are processed in parallel (OpenMP).
+ *
+ * The block pattern is symmetric (the transposed product uses the transposed blocks), the values need not be.
+ */
+class OOFEM_EXPORT BlockCompRow : public SparseMtrx
+{
+protected:
+    /// Size of blocks.
+    int bsize;
+    /// Equations of blocks (0-based, -1 for padding), bsize per block.
+    std :: vector< int >blockEq;
+    /// Block and local index of each equation (block * bsize + local index).
+    std :: vector< int >eqBlock;
+    /// Block rows, blocks of block row i are at positions rowPtr[i], ..., rowPtr[i+1]-1, sorted by column.
+    std :: vector< int >rowPtr;
+    std :: vector< int >colInd;
+    /// Position of the transposed block.
+    std :: vector< int >transPos;
+    /// Values of blocks, bsize*bsize per block.
+    std :: vector< double >values;
+
+public:
+    /**
+     * Constructor.
+     * Before any operation an internal profile must be built.
+     * @param n Size of matrix
+     * @see buildInternalStructure
+     */
+    BlockCompRow(int n = 0);
+    /// Copy constructor
+    BlockCompRow(const BlockCompRow &S) = default;
+    /// Destructor
+    virtual ~BlockCompRow() { }
+
+    std :: unique_ptr< SparseMtrx >clone() const override;
+    void times(const FloatArray &x, FloatArray &answer) const override;
+    void timesT(const FloatArray &x, FloatArray &answer) const override;
+    void times(double x) override;
+    int buildInternalStructure(EngngModel *eModel, int di, const UnknownNumberingScheme &s) override;
+    int assemble(const IntArray &loc, const FloatMatrix &mat) override;
+    int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool canBeFactorized() const override { return false; }
+    bool supportsColouredAssembly() const override { return true; }
+    void zero() override;
+    double &at(int i, int j) override;
+    double at(int i, int j) const override;
+    bool isAllocatedAt(int i, int j) const override { return this->givePosition(i - 1, j - 1) >= 0; }
+    void printStatistics() const override;
+    SparseMtrxType giveType() const override { return SMT_BlockCompRow; }
+    bool isAsymmetric() const override { return true; }
+    const char *giveClassName() const override { return "BlockCompRow"; }
+
+    /// Returns size of blocks.
+    int giveBlockSize() const { return bsize; }
+    /// Returns number of stored blocks.
+    int giveNumberOfBlocks() const { return ( int ) colInd.size(); }
+
+protected:
+    /// Returns the position of entry (i,j) (0-based) in values, or -1 if it is not in the structure.
+    std :: ptrdiff_t givePosition(int i, int j) const;
+    /// Returns the position of block (bi,bj) or -1.
+    int giveBlockPosition(int bi, int bj) const;
+    /// Computes answer = A x or A^T x with blocks of compile time size (0 for size given by bsize).
+    template< int BS >void multiply(const FloatArray &x, FloatArray &answer, bool transpose) const;
+};
+} // end namespace oofem
+#endif // blockcomprow_h
@@ -9,6 +9,7 @@
 #include "input/interfacetype.h"
 #include "utility/contextioresulttype.h"
 #include "utility/contextmode.h"
+#include "material/matstatusarena.h"
 
 namespace oofem {
 class GaussPoint;
@@ -24,6 +25,8 @@ class DataStream;
  *
  * Any object that stores its status in integration point is responsible for its creation,
  * initialization, and serialization.
+ *
+ * Statuses are allocated from the MaterialStatusArena active in the creating thread, if any.
  */
 class OOFEM_EXPORT IntegrationPointStatus
 {
@@ -39,6 +42,10 @@ public:
     IntegrationPointStatus(GaussPoint * g) : gp(g) { }
     /// Destructor.
     virtual ~IntegrationPointStatus() = default;
+
+    static void *operator new(std :: size_t size) { return MaterialStatusArena :: allocate(size); }
+    static void operator delete(void *ptr, std :: size_t size) { MaterialStatusArena :: deallocate(ptr, size); }
+
     /// Print receiver's output to given stream.
     virtual void printOutputAt(FILE *file, TimeStep *tStep) const { }
     /**
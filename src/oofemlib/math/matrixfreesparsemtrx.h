@@ -0,0 +1,135 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef matrixfreesparsemtrx_h
+#define matrixfreesparsemtrx_h
+
+#include "math/sparsemtrx.h"
+#include "math/floatarray.h"
+#include "math/floatmatrix.h"
+#include "input/assemblercallback.h"
+#include "solvers/timestep.h"
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+
+namespace oofem {
+class Domain;
+
+/**
+ * Sparse matrix which is never assembled.
+ * Instead of values, the receiver keeps the matrix assemblers, the element numbers and their location arrays;
+ * the element matrices are recomputed and applied element by element whenever the receiver is multiplied.
+ * The memory needed is thus proportional to the number of element code numbers, which allows to solve problems whose
+ * assembled matrix would not fit into memory, at the price of recomputing the element matrices in each iteration
+ * of the (iterative) linear solver.
+ *
+ * The element part is added by EngngModel::assemble (see addElementOperator), which recognizes the receiver and skips
+ * the element loop. Each assemble adds one element operator, so assembling several matrices into the receiver sums
+ * them up, and zero() removes all of them. Other contributions (loads, active boundary conditions) are assembled as
+ * usual and stored element by element. The diagonal and the diagonal blocks of dof managers are computed on demand,
+ * so the receiver can be used with diagonal and block Jacobi preconditioners of IMLSolver. Only the diagonal entries
+ * can be accessed by at().
+ *
+ * The element matrices are evaluated in (a copy of) the time step given to assemble, so the receiver stays valid when
+ * that step is deleted, but it has to be reassembled whenever the state of the elements changes (same as assembled
+ * matrices). The receiver can not be factorized; it is only usable with the iterative solvers of IMLSolver.
+ */
+class OOFEM_EXPORT MatrixFreeSparseMtrx : public SparseMtrx
+{
+protected:
+    /// Element part added by one assemble.
+    struct ElementOperator {
+        /// Copy of the assembler of element matrices.
+        std :: unique_ptr< MatrixAssembler >assembler;
+        /// Copy of the time step the element matrices are evaluated in.
+        std :: unique_ptr< TimeStep >tStep;
+        /// Scale factor of the element matrices.
+        double scale = 1.0;
+        /// Active elements, their location arrays are elemLoc[elemLocPtr[i]], ..., elemLoc[elemLocPtr[i+1]-1].
+        std :: vector< int >elements;
+        std :: vector< int >elemLocPtr;
+        std :: vector< int >elemLoc;
+    };
+
+    Domain *domain;
+    /// Element operators, their contributions are summed.
+    std :: vector< ElementOperator >operators;
+    /// Equations of dof managers, used for diagonal blocks; stored in the same compressed format.
+    std :: vector< int >blockPtr;
+    std :: vector< int >blockEq;
+
+    /// Other contributions (loads, boundary conditions).
+    std :: vector< IntArray >extraLoc;
+    std :: vector< FloatMatrix >extraMtrx;
+    /// Values added to the diagonal directly (see at()).
+    FloatArray diagonalShift;
+
+    /// Cached diagonal of the element contributions.
+    mutable FloatArray diagonal;
+    mutable std :: atomic< bool >diagonalValid;
+    mutable std :: mutex diagonalMutex;
+
+public:
+    /**
+     * Constructor.
+     * @param n Size of matrix
+     */
+    MatrixFreeSparseMtrx(int n = 0);
+    MatrixFreeSparseMtrx(const MatrixFreeSparseMtrx &mat);
+    /// Destructor
+    virtual ~MatrixFreeSparseMtrx() { }
+
+    /**
+     * Adds element operator to the receiver.
+     * @param eModel Engineering model, used to filter inactive elements.
+     * @param d Domain.
+     * @param tStep Time step the element matrices are evaluated in, the receiver keeps its copy.
+     * @param ma Matrix assembler, it has to support MatrixAssembler::clone.
+     * @param s Equation numbering.
+     */
+    void addElementOperator(EngngModel *eModel, Domain *d, TimeStep *tStep, const MatrixAssembler &ma, const UnknownNumberingScheme &s);
+    /// Returns the number of elements of all operators.
+    int giveNumberOfElements() const;
+    /// Returns the number of entries needed by the assembled element matrices.
+    std :: size_t giveNumberOfElementEntries() const;
+
+    /**
+     * Computes the diagonal blocks of the receiver belonging to the dof managers.
+     * @param blocks Blocks, square matrix for each dof manager with some equations.
+     * @param eqs Equations (1-based) of each block.
+     */
+    void computeDiagonalBlocks(std :: vector< FloatMatrix > &blocks, std :: vector< IntArray > &eqs) const;
+
+    std :: unique_ptr< SparseMtrx >clone() const override;
+    void times(const FloatArray &x, FloatArray &answer) const override;
+    void timesT(const FloatArray &x, FloatArray &answer) const override;
+    void times(double x) override;
+    int buildInternalStructure(EngngModel *eModel, int di, const UnknownNumberingScheme &s) override;
+    int assemble(const IntArray &loc, const FloatMatrix &mat) override;
+    int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool canBeFactorized() const override { return false; }
+    void zero() override;
+    double &at(int i, int j) override;
+    double at(int i, int j) const override;
+    void printStatistics() const override;
+    SparseMtrxType giveType() const override { return SMT_MatrixFree; }
+    bool isAsymmetric() const override { return true; }
+    const char *giveClassName() const override { return "MatrixFreeSparseMtrx"; }
+
+protected:
+    /**
+     * Computes the (rotated and scaled) matrix of i-th element of the operator.
+     * @return False if there is no contribution.
+     */
+    bool computeElementMatrix(const ElementOperator &op, int i, FloatMatrix &answer) const;
+    /// Calls visitor(loc, mat) for all contributions (elements in parallel, then the other contributions).
+    template< class Visitor >void visitContributions(Visitor &&visitor) const;
+    /// Computes the diagonal of the receiver.
+    void computeDiagonal() const;
+};
+} // end namespace oofem
+#endif // matrixfreesparsemtrx_h
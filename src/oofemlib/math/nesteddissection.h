@@ -0,0 +1,54 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef nesteddissection_h
+#define nesteddissection_h
+
+#include "oofemcfg.h"
+
+#include <vector>
+
+namespace oofem {
+/**
+ * Fill-reducing nested dissection ordering of a symmetric sparse matrix graph.
+ *
+ * The graph is recursively bisected using rooted level structures (as in Sloan's algorithm,
+ * the root is a pseudo-peripheral vertex found by repeated breadth first searches).
+ * The middle level of the structure provides the vertex separator, which is numbered after
+ * both parts. Subgraphs below the leaf size keep their incoming (typically profile optimized) order,
+ * so that the local numbering of the leaves remains banded.
+ * Disconnected subgraphs are split into their components without separator.
+ */
+class OOFEM_EXPORT NestedDissection
+{
+public:
+    /**
+     * Computes the ordering.
+     * @param n Number of graph vertices.
+     * @param adjPtr Start of adjacency list of each vertex (size n+1, 0-based).
+     * @param adjInd Adjacent vertices (0-based, self loops are ignored).
+     * @param perm Computed permutation, perm[new] = old.
+     * @param leafSize Subgraphs with at most leafSize vertices are not dissected further.
+     */
+    static void computeOrdering(int n, const std::vector< int > &adjPtr, const std::vector< int > &adjInd,
+                                std::vector< int > &perm, int leafSize = 64);
+
+private:
+    /**
+     * Splits given vertex set into two parts and a separator.
+     * @return False if the set can not be reasonably split.
+     */
+    static bool bisect(const std::vector< int > &verts, const std::vector< int > &adjPtr, const std::vector< int > &adjInd,
+                       std::vector< int > &inSet, int stamp, std::vector< int > &level,
+                       std::vector< int > &part1, std::vector< int > &part2, std::vector< int > &sep);
+    /**
+     * Builds the rooted level structure of the component containing root.
+     * @return Number of levels; levelVerts holds the vertices sorted by level, levelPtr the start of each level.
+     */
+    static int buildLevelStructure(int root, const std::vector< int > &adjPtr, const std::vector< int > &adjInd,
+                                   const std::vector< int > &inSet, int stamp, std::vector< int > &level,
+                                   std::vector< int > &levelVerts, std::vector< int > &levelPtr);
+};
+} // end namespace oofem
+#endif // nesteddissection_h
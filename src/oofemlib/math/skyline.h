@@ -75,6 +75,7 @@ public:
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
 
     bool canBeFactorized() const override { return true; }
+    bool supportsColouredAssembly() const override { return true; }
     SparseMtrx *factorized() override;
     FloatArray *backSubstitutionWith(FloatArray &) const override;
     void zero() override;
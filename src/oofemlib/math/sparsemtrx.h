@@ -50,19 +50,50 @@ protected:
      * matrix, if there is no change;
      */
     SparseMtrxVersionType version;
+    /// Equation numbering state stamp the internal structure was built for (0 if unknown).
+    int structureStamp;
+    /// Signature of the equation numbering the internal structure was built for.
+    std::size_t structureKey;
+    /// Set during coloured assembly, assemble then does not change the version (see beginColouredAssembly).
+    bool versionFrozen;
 
 public:
     /**
      * Constructor, creates (n,m) sparse matrix. Due to sparsity character of matrix,
      * not all coefficient are physically stored (in general, zero members are omitted).
      */
-    SparseMtrx(int n=0, int m=0) : nRows(n), nColumns(m), version(0) { }
+    SparseMtrx(int n=0, int m=0) : nRows(n), nColumns(m), version(0), structureStamp(0), structureKey(0), versionFrozen(false) { }
     /// Destructor
     virtual ~SparseMtrx() { }
 
     /// Return receiver version.
     SparseMtrxVersionType giveVersion() { return this->version; }
 
+    /**
+     * Returns true if assemble can be called concurrently for contributions which share no equations.
+     * This holds if assemble only adds to existing entries of the internal structure and, between
+     * beginColouredAssembly and endColouredAssembly, touches no other member of the receiver.
+     * Used by the coloured assembly mode of EngngModel, other matrices are assembled with locks.
+     */
+    virtual bool supportsColouredAssembly() const { return false; }
+    /// Starts concurrent assembly of one element colouring, the version is not changed by assemble until endColouredAssembly.
+    void beginColouredAssembly() { this->versionFrozen = true; }
+    /// Ends concurrent assembly, increments the version once.
+    void endColouredAssembly() { this->versionFrozen = false; this->version++; }
+
+    /**
+     * Records the equation numbering the internal structure was built for.
+     * Used by EngngModel::buildSparseMtrxStructure to reuse the structure (and symbolic factorization)
+     * when the equation numbering did not change.
+     * @param stamp Numbering state stamp of the engineering model.
+     * @param key Signature of the equation numbering.
+     */
+    void setStructureKey(int stamp, std::size_t key) { this->structureStamp = stamp; this->structureKey = key; }
+    /// Returns the numbering state stamp the internal structure was built for.
+    int giveStructureStamp() const { return this->structureStamp; }
+    /// Returns the signature of the equation numbering the internal structure was built for.
+    std::size_t giveStructureKey() const { return this->structureKey; }
+
     /**
      * Checks size of receiver towards requested bounds.
      * Current implementation will call exit(1), if positions are outside bounds.
@@ -209,6 +240,11 @@ public:
 
     /// Determines, whether receiver can be factorized.
     virtual bool canBeFactorized() const = 0;
+    /**
+     * Performs the structure dependent (symbolic) part of the factorization in advance, if the receiver has one.
+     * Copies of the receiver keep it, so it is done once for matrices sharing the structure.
+     */
+    virtual void symbolicFactorization() { }
     /**
      * Returns the receiver factorized. @f$ L^{\mathrm{T}} \cdot D \cdot L @f$ form is used.
      * @return pointer to the receiver
@@ -0,0 +1,49 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef sparsemtrxstructurecache_h
+#define sparsemtrxstructurecache_h
+
+#include "oofemcfg.h"
+#include "math/sparsemtrxtype.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+
+namespace oofem {
+class SparseMtrx;
+
+/**
+ * Sparse matrix structures shared by engineering models solving problems with identical equation numbering
+ * (e.g. the RVEs of multiscale materials created from one input).
+ * The first model building a structure stores its copy (including the symbolic factorization, if the matrix has one),
+ * the other models start from a copy of it instead of building their own.
+ * Access is thread safe. Stored matrices must support SparseMtrx::clone.
+ */
+class OOFEM_EXPORT SparseMtrxStructureCache
+{
+protected:
+    /// Stored structures, the values are zero.
+    std::vector< std::unique_ptr< SparseMtrx > >structures;
+    std::mutex mutex;
+
+public:
+    SparseMtrxStructureCache() { }
+    ~SparseMtrxStructureCache();
+
+    /**
+     * Returns a copy of stored structure of given type built for given numbering key, or null if there is none.
+     */
+    std::unique_ptr< SparseMtrx > giveCopy(SparseMtrxType type, std::size_t key);
+    /**
+     * Stores the structure of given matrix, unless structure of the same type and key is already stored.
+     */
+    void store(const SparseMtrx &mtrx);
+    /// Returns number of stored structures.
+    int giveNumberOfStructures();
+};
+} // end namespace oofem
+#endif // sparsemtrxstructurecache_h
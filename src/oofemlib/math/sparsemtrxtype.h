@@ -20,7 +20,10 @@ enum SparseMtrxType {
     SMT_PetscMtrx,     ///< PETSc library mtrx representation.
     SMT_DSS_sym_LDL,   ///< Richard Vondracek's sparse direct solver.
     SMT_DSS_sym_LL,    ///< Richard Vondracek's sparse direct solver.
-    SMT_DSS_unsym_LU   ///< Richard Vondracek's sparse direct solver.
+    SMT_DSS_unsym_LU,  ///< Richard Vondracek's sparse direct solver.
+    SMT_SymSupernodal, ///< Symmetric compressed column with built-in supernodal factorization.
+    SMT_MatrixFree,    ///< Element-by-element operator, not assembled.
+    SMT_BlockCompRow   ///< Block compressed row (nodal blocks).
 };
 } // end namespace oofem
 #endif // sparsematrixtype_h
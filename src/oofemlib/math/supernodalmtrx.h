@@ -0,0 +1,106 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef supernodalmtrx_h
+#define supernodalmtrx_h
+
+#include "math/symcompcol.h"
+
+#include <vector>
+
+namespace oofem {
+/**
+ * Symmetric sparse matrix with built-in supernodal multifrontal LDL^T factorization.
+ *
+ * The matrix is assembled in the symmetric compressed column format (see SymCompCol).
+ * Factorization is done in two phases:
+ * - Symbolic phase: nested dissection ordering of the matrix graph (see NestedDissection),
+ *   elimination tree and its postorder, fundamental supernodes and their row structure.
+ * - Numeric phase: multifrontal factorization. For each supernode, the dense frontal matrix is assembled
+ *   from the matrix entries and the update matrices of its children, its pivot block is factorized
+ *   and the Schur complement is passed to the parent. The dense kernels work on contiguous rows.
+ *   With OpenMP, independent subtrees of the supernodal tree are factorized concurrently and the
+ *   kernels of the remaining top supernodes are threaded.
+ *
+ * The assembled values are kept, so the receiver can still be multiplied after the factorization.
+ * The factorization does not change the version of the receiver; any change of values invalidates the factor.
+ * No pivoting is performed (same as Skyline), so the matrix should be positive or negative definite.
+ */
+class OOFEM_EXPORT SupernodalMtrx : public SymCompCol
+{
+protected:
+    /// Fill reducing permutation, perm[new] = old (0-based).
+    std::vector< int > perm;
+    /// Inverse permutation.
+    std::vector< int > iperm;
+    /// First column of each supernode (size nsuper+1).
+    std::vector< int > snodePtr;
+    /// Parent supernode (-1 for roots).
+    std::vector< int > snodeParent;
+    /// Children of supernodes in compressed form.
+    std::vector< int > snodeChildPtr, snodeChildren;
+    /// Row structure below the diagonal block of each supernode (new numbering, sorted).
+    std::vector< int > rowPtr, rowInd;
+    /// Offset of factor panel of each supernode in lVal.
+    std::vector< std::size_t > lPtr;
+    /// Entries of the lower part in new numbering, compressed by column; aSrc refers to val.
+    std::vector< int > aColPtr, aRowInd, aSrc;
+    /// Roots of subtrees factorized concurrently; the other supernodes are marked in topSnode.
+    std::vector< int > subtreeRoots;
+    /// First supernode of the subtree of each supernode (supernodes are postordered).
+    std::vector< int > snodeFirstDesc;
+    /// Flags supernodes factorized after all subtrees.
+    std::vector< bool > topSnode;
+    /// Flag indicating valid symbolic factorization.
+    bool symbolicDone;
+
+    /// Factor panels; row-major (ncols+nbelow) x ncols block of each supernode, unit diagonal implied.
+    std::vector< double > lVal;
+    /// Diagonal of D.
+    std::vector< double > dVal;
+    /// Version of the receiver the factor belongs to.
+    SparseMtrxVersionType factorVersion;
+    /// Flag indicating valid numeric factorization.
+    bool factorDone;
+
+public:
+    /**
+     * Constructor.
+     * Before any operation an internal profile must be built.
+     * @param n Size of matrix
+     * @see buildInternalStructure
+     */
+    SupernodalMtrx(int n=0);
+    /// Destructor
+    virtual ~SupernodalMtrx() { }
+
+    std::unique_ptr<SparseMtrx> clone() const override;
+    int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &) override;
+    bool canBeFactorized() const override { return true; }
+    SparseMtrx *factorized() override;
+    void symbolicFactorization() override;
+    FloatArray *backSubstitutionWith(FloatArray &y) const override;
+    void printStatistics() const override;
+    const char* giveClassName() const override { return "SupernodalMtrx"; }
+    SparseMtrxType giveType() const override { return SMT_SymSupernodal; }
+
+    /// Returns number of nonzeros of the factor (including the diagonal).
+    std::size_t giveFactorSize() const { return lVal.size(); }
+
+protected:
+    /// Computes the values of the factor.
+    void numericFactorization();
+    /// Selects subtrees which are factorized concurrently.
+    void scheduleSubtrees(int nthreads);
+    /**
+     * Assembles and factorizes the frontal matrix of given supernode.
+     * @param s Supernode.
+     * @param update Update matrices (packed lower triangle) of all supernodes, children are consumed.
+     * @param relpos Scratch array of size n.
+     * @param threaded Allows threading of dense kernels.
+     */
+    void factorizeSupernode(int s, std::vector< std::vector< double > > &update, std::vector< int > &relpos, bool threaded);
+};
+} // end namespace oofem
+#endif // supernodalmtrx_h
@@ -0,0 +1,40 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef supernodalsolver_h
+#define supernodalsolver_h
+
+#include "solvers/sparselinsystemnm.h"
+#include "solvers/convergedreason.h"
+#include "math/sparsemtrx.h"
+#include "math/floatarray.h"
+
+#define _IFT_SupernodalSolver_Name "supernodal"
+
+namespace oofem {
+class Domain;
+class EngngModel;
+
+/**
+ * Implements the solution of linear system of equation in the form Ax=b using the built-in
+ * supernodal multifrontal LDL^T factorization (see SupernodalMtrx). No external libraries are needed;
+ * the factorization is threaded when compiled with OpenMP.
+ * The factor is reused as long as the matrix does not change.
+ */
+class OOFEM_EXPORT SupernodalSolver : public SparseLinearSystemNM
+{
+public:
+    /// Constructor - creates new instance of SupernodalSolver, belonging to domain d and Engngmodel m.
+    SupernodalSolver(Domain * d, EngngModel * m);
+    /// Destructor
+    virtual ~SupernodalSolver();
+
+    ConvergedReason solve(SparseMtrx &A, FloatArray &b, FloatArray &x) override;
+
+    const char *giveClassName() const override { return "SupernodalSolver"; }
+    LinSystSolverType giveLinSystSolverType() const override { return ST_Supernodal; }
+    SparseMtrxType giveRecommendedMatrix(bool symmetric) const override { return symmetric ? SMT_SymSupernodal : SMT_SkylineU; }
+};
+} // end namespace oofem
+#endif // supernodalsolver_h
@@ -0,0 +1,173 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef flatoctreelocalizer_h
+#define flatoctreelocalizer_h
+
+#include "oofemcfg.h"
+#include "mesher/spatiallocalizer.h"
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+namespace oofem {
+class IntegrationRule;
+
+/// Max desired number of nodes per leaf octant.
+#define FLATOCTREE_MAX_NODES_LIMIT 10
+/// Max octree depth.
+#define FLATOCTREE_MAX_DEPTH 16
+
+/**
+ * Spatial localizer based on a flat octree.
+ * Offers the same services as OctreeSpatialLocalizer, but the tree is stored in contiguous arrays without pointers:
+ * - octants are kept in one array and refer to their parent and children by index, children of an octant are stored consecutively,
+ * - the tree is built in bulk; node positions are encoded into Morton (Z-order) keys, nodes are sorted by them and each
+ *   octant is subdivided by splitting its range of keys. The leaves are thus numbered in Morton order, each leaf owns
+ *   a contiguous range of (sorted) nodes and each octant a contiguous range of leaves,
+ * - lists of elements assigned to leaves are stored in compressed row format,
+ * - node coordinates and global coordinates of integration points of default integration rules are cached, so the
+ *   distance tests do not touch the nodes and elements at all.
+ *
+ * The point location is a binary search of the point key in the keys of the leaves, the box queries traverse the
+ * tree using a fixed size stack. All queries are read only and may be called concurrently.
+ * As the cached coordinates are not updated, init(true) has to be called whenever the geometry changes
+ * (the tree of OctreeSpatialLocalizer needs to be rebuilt in that case as well).
+ */
+class OOFEM_EXPORT FlatOctreeSpatialLocalizer : public SpatialLocalizer
+{
+protected:
+    /// Octant of the tree.
+    struct Cell {
+        /// Octant center.
+        std :: array< double, 3 >center;
+        /// Half of the octant width.
+        double halfWidth;
+        /// Index of the parent octant, -1 for root.
+        int parent;
+        /// Index of the first child (children are stored consecutively), -1 for leaves.
+        int firstChild;
+        /// Range of leaves within the octant.
+        int leafBegin, leafEnd;
+    };
+
+    /// Lists of numbers assigned to the leaves, in compressed row format.
+    struct LeafLists {
+        std :: vector< int >ptr;
+        std :: vector< int >items;
+
+        /// Builds the lists from (leaf, item) pairs, items are sorted and unique within each list.
+        void build(int nleaves, std :: vector< std :: pair< int, int > > &pairs);
+        const int *begin(int leaf) const { return items.data() + ptr [ leaf ]; }
+        const int *end(int leaf) const { return items.data() + ptr [ leaf + 1 ]; }
+    };
+
+    /// Octants, the root has index 0.
+    std :: vector< Cell >cells;
+    /// Octant index of each leaf.
+    std :: vector< int >leafCells;
+    /// Morton key of lower corner of each leaf (increasing).
+    std :: vector< std :: uint64_t >leafKeys;
+    /// Node numbers sorted by Morton key, nodes of leaf i are leafNodePtr[i], ..., leafNodePtr[i+1]-1.
+    std :: vector< int >nodes;
+    std :: vector< int >leafNodePtr;
+    /// Coordinates of sorted nodes (3 per node).
+    std :: vector< double >nodeCoords;
+    /// Elements with integration point or node within the leaf.
+    LeafLists ipElements;
+    /// Integration points of default rule of element e are elementIPPtr[e-1], ..., elementIPPtr[e]-1.
+    std :: vector< int >elementIPPtr;
+    /// Global coordinates of integration points (3 per point).
+    std :: vector< double >ipCoords;
+    /// Elements with bounding box overlapping the leaf, for each region (0 for all regions).
+    std :: vector< LeafLists >regionElements;
+    std :: unique_ptr< std :: atomic< bool >[] >regionElementsInitialized;
+
+    /// Lower corner of the root octant.
+    std :: array< double, 3 >rootLower;
+    /// Width of the root octant.
+    double rootWidth;
+    /// Dimensions used for subdivision (degenerated dimensions are skipped) and their number.
+    std :: array< int, 3 >activeDims;
+    int nActiveDims;
+    /// Number of key bits per active dimension.
+    int keyBits;
+
+    std :: atomic< bool >initialized;
+    std :: atomic< bool >ipElementsInitialized;
+    std :: mutex initMutex;
+
+public:
+    /// Constructor
+    FlatOctreeSpatialLocalizer(Domain * d);
+    /// Destructor
+    virtual ~FlatOctreeSpatialLocalizer() { }
+
+    int init(bool force = false) override;
+
+    Element *giveElementContainingPoint(const FloatArray &coords, const IntArray *regionList = nullptr) override;
+    Element *giveElementContainingPoint(const FloatArray &coords, const Set &eset) override;
+    Element *giveElementClosestToPoint(FloatArray &lcoords, FloatArray &closest, const FloatArray &gcoords, int region) override;
+
+    GaussPoint *giveClosestIP(const FloatArray &coords, int region, bool iCohesiveZoneGP = false) override;
+    GaussPoint *giveClosestIP(const FloatArray &coords, Set &elemSet, bool iCohesiveZoneGP = false) override;
+
+    void giveAllElementsWithIpWithinBox_EvenIfEmpty(elementContainerType &elemSet, const FloatArray &coords, const double radius) override;
+    void giveAllElementsWithIpWithinBox(elementContainerType &elemSet, const FloatArray &coords, const double radius) override;
+
+    void giveAllNodesWithinBox(nodeContainerType &nodeList, const FloatArray &coords, const double radius) override;
+    Node *giveNodeClosestToPoint(const FloatArray &coords, double maxDist) override;
+
+    /// Returns the number of leaves of the tree.
+    int giveNumberOfLeaves() const { return ( int ) leafCells.size(); }
+    const char *giveClassName() const override { return "FlatOctreeSpatialLocalizer"; }
+
+protected:
+    /// Builds the tree and the node lists.
+    void buildOctreeDataStructure();
+    /**
+     * Subdivides given octant and its children recursively.
+     * @param cell Octant index.
+     * @param keys Sorted node keys.
+     * @param begin First node of octant.
+     * @param end One past the last node of octant.
+     * @param depth Octant depth.
+     * @param key Key of lower corner of octant.
+     * @param maxDepth Max tree depth.
+     */
+    void buildCell(int cell, const std :: vector< std :: uint64_t > &keys, int begin, int end, int depth, std :: uint64_t key, int maxDepth);
+    /// Builds the lists of elements having integration point or node in leaves, and the cache of integration point coordinates.
+    void initElementIPDataStructure();
+    /// Builds the lists of elements overlapping leaves by their bounding box.
+    void initElementDataStructure(int region);
+
+    /// Returns the Morton key of given point (points outside root octant are moved to its boundary).
+    std :: uint64_t giveKey(const double *coords) const;
+    /// Returns the leaf containing given point.
+    int giveLeafContaining(const double *coords) const;
+    /// Returns true if the octant overlaps the box with given center and half width.
+    bool overlaps(const Cell &cell, const double *coords, double radius) const;
+    /// Returns true if the octant is inside the box with given center and half width.
+    bool isInside(const Cell &cell, const double *coords, double radius) const;
+    /**
+     * Calls visitor for all leaves overlapping given box.
+     * The box half width can be decreased by the visitor, the remaining part of the tree is pruned using the updated value.
+     */
+    template< class Visitor >void visitLeavesInBox(const double *coords, const double &radius, Visitor &&visitor) const;
+    /**
+     * Calls visitor(x, rule, i) for the integration points of given element, where x are the global coordinates of i-th point of the rule.
+     * Either the default rule (using the cached coordinates) or the cohesive zone rules of xfem elements are visited.
+     */
+    template< class Visitor >void visitElementIPs(Element *elem, bool iCohesiveZoneGP, Visitor &&visitor) const;
+    /// Returns the element containing given point, elements are filtered by the accept function.
+    template< class Filter >Element *giveElementContainingPoint(const double *coords, const FloatArray &gcoords, Filter &&accept);
+    /// Returns the closest integration point, elements are filtered by the accept function.
+    template< class Filter >GaussPoint *giveClosestIP(const double *coords, bool iCohesiveZoneGP, Filter &&accept);
+};
+} // end namespace oofem
+#endif // flatoctreelocalizer_h
@@ -0,0 +1,17 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef spatiallocalizertype_h
+#define spatiallocalizertype_h
+
+namespace oofem {
+/**
+ * Enumerative type used to identify the spatial localizer of domain.
+ */
+enum SpatialLocalizerType {
+    SLT_Octree,     ///< Octree with linked octants (OctreeSpatialLocalizer).
+    SLT_FlatOctree  ///< Flat octree with Morton ordered leaves (FlatOctreeSpatialLocalizer).
+};
+} // end namespace oofem
+#endif // spatiallocalizertype_h
@@ -41,11 +41,15 @@
 #define _IFT_NRSolver_forceScale "forcescale"
 #define _IFT_NRSolver_forceScaleDofs "forcescaledofs"
 #define _IFT_NRSolver_solutionDependentExternalForces "soldepextforces"
+#define _IFT_NRSolver_qnmode "qnmode"
+#define _IFT_NRSolver_qnmaxupdates "qnmaxupdates"
+#define _IFT_NRSolver_qnrestartratio "qnrestartratio"
 //@}
 
 namespace oofem {
 class Domain;
 class EngngModel;
+class ParallelContext;
 
 /**
  * This class implements Newton-Raphson Method, derived from abstract NumericalMethod class
@@ -68,6 +72,8 @@ class OOFEM_EXPORT NRSolver : public SparseNonLinearSystemNM
 {
 protected:
     enum nrsolver_ModeType { nrsolverModifiedNRM, nrsolverFullNRM, nrsolverAccelNRM };
+    /// Type of quasi-Newton update applied to the inverse of the factorized tangent.
+    enum nrsolver_QNType { nrsolverQN_None, nrsolverQN_LBFGS, nrsolverQN_Broyden };
 
     int nsmax, minIterations;
     double minStepLength;
@@ -134,6 +140,23 @@ protected:
     std :: map< int, double >dg_forceScale;
 
     double maxIncAllowed;
+
+    /**
+     * Quasi-Newton mode. The tangent is factorized at the beginning of the step and the inverse is corrected by
+     * low-rank updates (limited memory BFGS, or Broyden) in the subsequent iterations.
+     */
+    nrsolver_QNType qnType;
+    /// Max number of quasi-Newton updates, the tangent is refreshed when reached.
+    int qnMaxUpdates;
+    /// The tangent is refreshed when the residual norm grows more than qnRestartRatio times in one iteration.
+    double qnRestartRatio;
+    /// Stored updates: increments and residual differences (BFGS) or update vectors (Broyden).
+    std :: vector< FloatArray >qnSteps, qnVectors;
+    /// Inverse products of stored increments and residual differences (BFGS).
+    std :: vector< double >qnRho;
+    /// Last residual, last quasi-Newton direction and last increment of solution.
+    FloatArray qnLastRhs, qnLastDirection, qnLastStep;
+
 public:
     NRSolver(Domain *d, EngngModel *m);
     virtual ~NRSolver();
@@ -182,6 +205,16 @@ protected:
      */
     bool checkConvergence(FloatArray &RT, FloatArray &F, FloatArray &rhs, FloatArray &ddX, FloatArray &X,
                           double RRT, const FloatArray &internalForcesEBENorm, int nite, bool &errorOutOfRange);
+
+    /**
+     * Computes the quasi-Newton increment of solution for given residual.
+     * The update given by the last increment (qnLastStep) and residual change is added first.
+     * @return False if the update is degraded (or the max number of updates is reached) and the tangent has to be refreshed;
+     * the increment is not computed in that case.
+     */
+    bool computeQuasiNewtonIncrement(SparseMtrx &k, FloatArray &rhs, FloatArray &ddX, ParallelContext *parallel_context);
+    /// Clears the quasi-Newton updates (after the tangent has been refreshed).
+    void clearQuasiNewtonUpdates();
 };
 } // end namespace oofem
 #endif // nrsolver_h
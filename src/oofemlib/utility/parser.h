@@ -7,10 +7,82 @@
 
 #include "oofemcfg.h"
 
+#include <string>
+#include <vector>
+
 namespace oofem {
 #define Parser_CMD_LENGTH 1024
 #define Parser_TBLSZ 23
 
+/**
+ * Compiled form of an expression, produced by Parser::compile.
+ * The expression is stored as a sequence of stack machine instructions.
+ * Variables are bound by slots; the caller fills the values of the input slots (variables which are read
+ * before being assigned by the expression) and the expression can then be evaluated repeatedly
+ * without any parsing. Evaluation does not modify the receiver, so one compiled expression can be shared by threads.
+ */
+class OOFEM_EXPORT CompiledExpression
+{
+public:
+    /// Instruction codes.
+    enum OpCode : unsigned char {
+        OP_Const, OP_Load, OP_Store, OP_Pop, OP_Neg,
+        OP_Add, OP_Sub, OP_Mul, OP_Div, OP_Mod, OP_Pow,
+        OP_Eq, OP_Le, OP_Lt, OP_Ge, OP_Gt,
+        OP_Sqrt, OP_Sin, OP_Cos, OP_Tan, OP_Atan, OP_Asin, OP_Acos, OP_Exp, OP_Int,
+        OP_Heaviside, OP_Heaviside1
+    };
+
+protected:
+    struct Instruction {
+        OpCode op;
+        /// Constant index or slot number.
+        int arg;
+    };
+
+    /// Program.
+    std :: vector< Instruction > code;
+    /// Constants referenced by program.
+    std :: vector< double > constants;
+    /// Variable names of slots.
+    std :: vector< std :: string > slotNames;
+    /// Flags slots read before assigned, their values have to be provided by caller.
+    std :: vector< bool > inputSlots;
+    /// Maximal depth of evaluation stack.
+    int maxStackSize;
+
+    friend class Parser;
+
+public:
+    CompiledExpression() : maxStackSize(0) { }
+
+    /// Returns true if no expression has been compiled into receiver.
+    bool isEmpty() const { return code.empty(); }
+    /// Returns number of variable slots.
+    int giveNumberOfSlots() const { return (int)slotNames.size(); }
+    /// Returns variable name of given slot (0-based).
+    const std :: string &giveSlotName(int slot) const { return slotNames [ slot ]; }
+    /// Returns true if the value of given slot has to be set before evaluation.
+    bool isInputSlot(int slot) const { return inputSlots [ slot ]; }
+    /// Returns slot of given variable, or -1 if expression does not use it.
+    int giveSlot(const std :: string &name) const;
+
+    /**
+     * Evaluates the expression.
+     * @param slots Values of variables, array of size giveNumberOfSlots(). Input slots have to be set,
+     * variables assigned by the expression are written back.
+     * @return Value of the last statement.
+     */
+    double evaluate(double *slots) const;
+
+protected:
+    /// Returns slot of given variable, new slot is created if not present.
+    int giveOrCreateSlot(const char *name);
+    /// Appends instruction and updates the required stack size.
+    void emit(OpCode op, int arg, int &depth);
+};
+
+
 /**
  * Class for evaluating mathematical expressions in strings.
  * Strings should be in MATLAB syntax. The parser understands variable names with values set by "x=expression;"
@@ -20,6 +92,9 @@ namespace oofem {
  *
  * Example string:
  * x=3;y=7;sqrt(x*(x/y+3))
+ *
+ * The parser is a front end producing CompiledExpression; expressions evaluated repeatedly with different
+ * variable values should be compiled once and evaluated with bound slots instead of calling eval.
  */
 class OOFEM_EXPORT Parser
 {
@@ -27,6 +102,8 @@ public:
     Parser() {
         curr_tok = PRINT;
         no_of_errors = 0;
+        target = nullptr;
+        depth = 0;
         for ( int i = 0; i < Parser_TBLSZ; i++ ) {
             table [ i ] = 0;
         }
@@ -35,7 +112,18 @@ public:
         reset();
     }
 
+    /**
+     * Compiles and evaluates given string. Variables not assigned in the string are taken from
+     * previous evaluations, assigned variables are remembered.
+     */
     double eval(const char *string, int &err);
+    /**
+     * Compiles given string.
+     * @param string Expression.
+     * @param answer Compiled expression.
+     * @param err Number of errors.
+     */
+    void compile(const char *string, CompiledExpression &answer, int &err);
     void   reset();
 
 private:
@@ -57,14 +145,21 @@ private:
     double number_value;
     char string_value [ Parser_CMD_LENGTH ];
     const char *parsedLine;
+    /// Expression being compiled.
+    CompiledExpression *target;
+    /// Current depth of evaluation stack of compiled code.
+    int depth;
 
     name *look(const char *p, int ins = 0);
     inline name *insert(const char *s) { return look(s, 1); }
     void error(const char *s);
-    double expr(bool get);
-    double term(bool get);
-    double prim(bool get);
-    double agr(bool get);
+    void expr(bool get);
+    void term(bool get);
+    void prim(bool get);
+    void agr(bool get);
+    void emit(CompiledExpression :: OpCode op, int arg = 0) { target->emit(op, arg, depth); }
+    /// Emits load of given variable, marking it as input if it has not been assigned yet.
+    void emitLoad(int slot);
     Token_value get_token();
 };
 } // end namespace oofem
@@ -68,6 +68,8 @@ public:
     SimpleCrossSection(int n, Domain *d) : StructuralCrossSection(n, d) { }
 
     FloatArrayF< 6 >giveRealStress_3d(const FloatArrayF< 6 > &reducedStrain, GaussPoint *gp, TimeStep *tStep) const override;
+    void giveRealStresses_3d(std :: vector< FloatArrayF< 6 > > &answer, const std :: vector< FloatArrayF< 6 > > &strain,
+                             const std :: vector< GaussPoint * > &gp, TimeStep *tStep) const override;
     FloatArrayF< 6 >giveRealStress_3dDegeneratedShell(const FloatArrayF< 6 > &reducedStrain, GaussPoint *gp, TimeStep *tStep) const override;
     FloatArrayF< 4 >giveRealStress_PlaneStrain(const FloatArrayF< 4 > &reducedStrain, GaussPoint *gp, TimeStep *tStep) const override;
     FloatArrayF< 3 >giveRealStress_PlaneStress(const FloatArrayF< 3 > &reducedStrain, GaussPoint *gp, TimeStep *tStep) const override;
@@ -75,6 +75,16 @@ public:
     virtual FloatArrayF< 1 >giveRealStress_1d(const FloatArrayF< 1 > &reducedStrain, GaussPoint *gp, TimeStep *tStep) const = 0;
     virtual FloatArrayF< 2 >giveRealStress_Warping(const FloatArrayF< 2 > &reducedStrain, GaussPoint *gp, TimeStep *tStep) const = 0;
     //@}
+    /**
+     * Computes the real stresses of several integration points in 3d mode at once (see StructuralMaterial::giveRealStressVectors_3d).
+     * Default implementation calls giveRealStress_3d for each point.
+     * @param answer Stress vectors of points.
+     * @param strain Strain vectors of points.
+     * @param gp Integration points.
+     * @param tStep Current time step.
+     */
+    virtual void giveRealStresses_3d(std :: vector< FloatArrayF< 6 > > &answer, const std :: vector< FloatArrayF< 6 > > &strain,
+                                     const std :: vector< GaussPoint * > &gp, TimeStep *tStep) const;
 
     /**
      * Method for computing the stiffness matrix.
@@ -0,0 +1,72 @@
+// Originated from OOFEM (https://github.com/oofem/oofem)
+// License: GNU Lesser General Public
+// Modified by CY Li
+
+#ifndef gpgeometrycache_h
+#define gpgeometrycache_h
+
+#include "oofemcfg.h"
+
+#include <vector>
+#include <cstddef>
+#include <atomic>
+
+namespace oofem {
+class FloatMatrix;
+class IntegrationRule;
+
+/**
+ * Cache of geometrical quantities of element integration points.
+ * For each integration point of one integration rule, the geometrical matrix B and the integration volume dV are
+ * stored in contiguous arrays, so that they are evaluated (shape function derivatives, jacobian and its inverse)
+ * only once instead of in every iteration. The cached values are valid as long as the element geometry does not
+ * change, the owner is responsible for invalidation (remeshing, updated Lagrangian formulation).
+ */
+class OOFEM_EXPORT GaussPointGeometryCache
+{
+protected:
+    /// Integration rule the cache was built for.
+    const IntegrationRule *iRule;
+    /// Offsets of B matrices of integration points in bValues (number of points + 1).
+    std :: vector< int >bOffset;
+    /// Sizes of B matrices.
+    std :: vector< int >bRows, bCols;
+    /// Values of B matrices (column-wise, as in FloatMatrix).
+    std :: vector< double >bValues;
+    /// Integration volumes.
+    std :: vector< double >dV;
+    /// Number of lookups served from the cache and number of times the cache was filled (elements are evaluated in parallel).
+    std :: atomic< std :: size_t >nHits, nBuilds;
+
+public:
+    GaussPointGeometryCache() : iRule(nullptr), nHits(0), nBuilds(0) { }
+
+    /// Returns true if the cache holds values for the given integration rule.
+    bool isValidFor(const IntegrationRule *ir) const { return iRule == ir && iRule; }
+    /// Clears the receiver, values are computed again on next use.
+    void invalidate();
+
+    /**
+     * Starts filling the cache for given integration rule.
+     * @param ir Integration rule.
+     * @param nip Number of integration points.
+     */
+    void initialize(const IntegrationRule *ir, int nip);
+    /// Stores the values of i-th (0-based) integration point, points must be stored in order.
+    void store(int i, const FloatMatrix &b, double volume);
+
+    /// Returns B matrix of i-th (0-based) integration point.
+    void giveBmatrix(int i, FloatMatrix &answer) const;
+    /// Returns integration volume of i-th (0-based) integration point.
+    double giveVolume(int i) const { return dV [ i ]; }
+
+    /// Counts a lookup served from the cache.
+    void registerHit() { nHits.fetch_add(1, std :: memory_order_relaxed); }
+    std :: size_t giveNumberOfHits() const { return nHits.load(std :: memory_order_relaxed); }
+    std :: size_t giveNumberOfBuilds() const { return nBuilds.load(std :: memory_order_relaxed); }
+
+    /// Returns memory used by the receiver in bytes.
+    std :: size_t giveMemoryUsage() const;
+};
+} // end namespace oofem
+#endif // gpgeometrycache_h
@@ -11,9 +11,15 @@
 #include "math/integrationdomain.h"
 #include "dofman/dofmantransftype.h"
 #include "math/floatarray.h"
+#include "sm/Elements/gpgeometrycache.h"
 
 #include <memory>
 
+///@name Input fields for StructuralElement
+//@{
+#define _IFT_StructuralElement_geometryCache "geocache"
+//@}
+
 namespace oofem {
 #define ALL_STRAINS -1
 
@@ -67,6 +73,8 @@ class OOFEM_EXPORT StructuralElement : public Element
 protected:
     /// Initial displacement vector, describes the initial nodal displacements when element has been casted.
     std::unique_ptr< FloatArray >initialDisplacements;
+    /// Cache of B matrices and integration volumes of default integration rule, allocated if requested by input.
+    std::unique_ptr< GaussPointGeometryCache >geometryCache;
 
 public:
     /**
@@ -308,7 +316,35 @@ public:
 
     virtual void createMaterialStatus();
 
+    /**@name Geometry cache services.
+     * Opt-in cache of the geometrical matrices and integration volumes of the default integration rule, used by the
+     * small strain stiffness, internal forces and strain evaluation. It is valid as long as the element geometry does
+     * not change; it is invalidated after remeshing (adaptiveUpdate) and after each step of updated Lagrangian
+     * formulation. Requires approx. (strain size x number of dofs + 1) doubles per integration point.
+     */
+    //@{
+    /// Returns true if the geometry cache is enabled.
+    bool hasGeometryCache() const { return geometryCache != nullptr; }
+    /// Enables or disables the geometry cache.
+    void setGeometryCache(bool flag);
+    /// Clears the cached values, they are recomputed on next use.
+    void invalidateGeometryCache();
+    /// Returns memory used by the geometry cache in bytes (zero if disabled).
+    std::size_t giveGeometryCacheMemoryUsage() const;
+    /// Returns the geometry cache (null if disabled).
+    const GaussPointGeometryCache *giveGeometryCache() const { return geometryCache.get(); }
+    //@}
+
 protected:
+    /**
+     * Returns the geometrical matrix at given integration point, taken from the geometry cache if enabled and gp
+     * belongs to the default integration rule, otherwise computed by computeBmatrixAt.
+     */
+    void giveCachedBmatrixAt(GaussPoint *gp, FloatMatrix &answer);
+    /// Returns the integration volume, taken from the geometry cache if possible, otherwise computed by computeVolumeAround.
+    double giveCachedVolumeAround(GaussPoint *gp);
+    /// Returns true if the geometry cache can be used for given integration point (and builds it if needed).
+    bool checkGeometryCache(GaussPoint *gp);
 
 
     /**
@@ -94,6 +94,11 @@ protected:
      * @param tStep Solution step.
      */
     void updateInternalState(TimeStep *tStep);
+    /**
+     * Reports the number of elements with geometry cache enabled and the memory used by the caches.
+     * @see StructuralElement::giveGeometryCacheMemoryUsage
+     */
+    void printGeometryCacheStatistics();
 
     void printOutputAt(FILE *file, TimeStep *tStep) override;
 
@@ -612,6 +612,14 @@ public:
         RT_Auxiliary
     };
 
+    /// Elastic predictor of one integration point (trial effective stress, its coordinates, yield value and equivalent strain).
+    struct TrialState {
+        FloatArrayF< 6 >effectiveStress;
+        double sig, rho, theta;
+        double yieldValue;
+        double equivStrain;
+    };
+
 
 protected:
     /// Parameters of the yield surface of the plasticity model. fc is the uniaxial compressive strength, ft the uniaxial tensile strength and ecc controls the out of roundness of the deviatoric section.
@@ -721,6 +729,46 @@ public:
     const char *giveInputRecordName() const override { return _IFT_ConcreteDPM2_Name; }
 
     FloatArrayF< 6 >giveRealStressVector_3d(const FloatArrayF< 6 > &strain, GaussPoint *gp, TimeStep *tStep) const override;
+    /**
+     * Batched stress evaluation. The elastic predictors of all points are computed at once by computeTrialStates
+     * (structure-of-arrays kernel vectorized over points), the plastic return and damage are then evaluated point by
+     * point, reusing the predictor. The results are the same as of giveRealStressVector_3d. The points are evaluated
+     * one by one if their elastic stiffnesses differ.
+     */
+    void giveRealStressVectors_3d(std::vector< FloatArrayF< 6 > > &answer, const std::vector< FloatArrayF< 6 > > &strain,
+                                  const std::vector< GaussPoint * > &gp, TimeStep *tStep) const override;
+
+    /**
+     * Computes the elastic predictors of n points given in structure-of-arrays form (component k of point i is stored
+     * at position k*n+i). Uses the same operations as the scalar path (dot, computeCoordinates, computeYieldValue,
+     * computeEquivalentStrain).
+     * @param n Number of points.
+     * @param D Elastic stiffness matrix.
+     * @param strain Strains (without stress independent part), 6*n values.
+     * @param plasticStrain Plastic strains of previous step, 6*n values.
+     * @param kappaP Hardening variables of previous step.
+     * @param stress Computed trial effective stresses, 6*n values.
+     * @param sig Computed volumetric coordinates.
+     * @param rho Computed deviatoric coordinates.
+     * @param theta Computed Lode angles.
+     * @param yieldValue Computed yield function values.
+     * @param equivStrain Computed equivalent strains.
+     */
+    void computeTrialStates(int n, const FloatMatrixF< 6, 6 > &D, const double *strain, const double *plasticStrain, const double *kappaP,
+                            double *stress, double *sig, double *rho, double *theta, double *yieldValue, double *equivStrain) const;
+
+    /**
+     * Scalar kernels on plain doubles, shared by computeTrialStates and by the scalar functions
+     * (computeHardeningOne, computeHardeningTwo, computeYieldValue, computeEquivalentStrain).
+     */
+    //@{
+    static double hardeningOne(double kappa, double yieldHardInitial, double yieldHardPrimePeak);
+    static double hardeningTwo(double kappa, double yieldHardPrimePeak);
+    /// Elliptic function r of the deviatoric section.
+    static double rFunction(double theta, double ecc);
+    static double yieldValue(double sig, double rho, double rFunction, double yieldHardOne, double yieldHardTwo, double fc, double m);
+    static double equivalentStrain(double sig, double rho, double rFunction, double fc, double m, double e0);
+    //@}
 
     bool hasMaterialModeCapability(MaterialMode mode) const override;
 
@@ -729,10 +777,12 @@ public:
      * @param gp Gauss point.
      * @param D stiffness matrix
      * @param strain Strain vector of this Gauss point.
+     * @param trial Elastic predictor, if already computed.
      */
     FloatArrayF< 6 >performPlasticityReturn(GaussPoint *gp,
                                             const FloatMatrixF< 6, 6 > &D,
-                                            const FloatArrayF< 6 > &strain) const;
+                                            const FloatArrayF< 6 > &strain,
+                                            const TrialState *trial = nullptr) const;
 
     /**
      * Check if the trial stress state falls within the vertex region of the plasticity model at the apex of triaxial extension or triaxial compression.
@@ -1017,14 +1067,15 @@ public:
                             double sig) const;
 
     /// Compute damage parameters
-    FloatArrayF< 2 >computeDamage(const FloatArrayF< 6 > &strain, const FloatMatrixF< 6, 6 > &D, double timeFactor, GaussPoint *gp, TimeStep *tStep, double alpha, const FloatArrayF< 6 > &effectiveStress) const;
+    FloatArrayF< 2 >computeDamage(const FloatArrayF< 6 > &strain, const FloatMatrixF< 6, 6 > &D, double timeFactor, GaussPoint *gp, TimeStep *tStep, double alpha, const FloatArrayF< 6 > &effectiveStress, const TrialState *trial = nullptr) const;
 
 
     /// Check for un- and reloading in the damage part
     int checkForUnAndReloading(double &tempEquivStrain,
                                double &minEquivStrain,
                                const FloatMatrixF< 6, 6 > &D,
-                               GaussPoint *gp) const;
+                               GaussPoint *gp,
+                               const TrialState *trial = nullptr) const;
 
     /// Compute alpha for rate effect
     double computeAlpha(FloatArrayF< 6 > &effectiveStressTension, FloatArrayF< 6 > &effectiveStressCompression, const FloatArrayF< 6 > &effectiveStress) const;
@@ -1096,6 +1147,17 @@ public:
 
 protected:
     MaterialStatus *CreateStatus(GaussPoint *gp) const override;
+
+    /**
+     * Computes the stress from the strain (stress independent strain removed) and updates the temporary state.
+     * Shared by the scalar and batched stress evaluation.
+     * @param fullStrainVector Total strain.
+     * @param strainVector Strain without stress independent part.
+     * @param D Elastic stiffness matrix.
+     * @param trial Elastic predictor, if already computed.
+     */
+    FloatArrayF< 6 >performStressUpdate(const FloatArrayF< 6 > &fullStrainVector, const FloatArrayF< 6 > &strainVector, const FloatMatrixF< 6, 6 > &D,
+                                        GaussPoint *gp, TimeStep *tStep, const TrialState *trial) const;
 };
 } //end namespace oofem
 #endif
@@ -120,6 +120,10 @@ public:
     /// Compute the factor that specifies how the interaction length should be modified (by eikonal nonlocal damage models)
     double giveNonlocalMetricModifierAt(GaussPoint *gp) const override;
 
+    /// The averaging kernel is used unless the weights are modified (stress-based averaging, eikonal models).
+    bool hasNonlocalAveragingKernel() const override { return nlvar != NLVT_StressBased && !( averType >= 2 && averType <= 6 ); }
+    double giveLocalVariableForAverage(GaussPoint *gp) const override;
+
     int giveIPValue(FloatArray &answer, GaussPoint *gp, InternalStateType type, TimeStep *tStep) override;
 
 
@@ -134,7 +138,7 @@ public:
      * references to integration points and their weights that influence to nonlocal average in
      * receiver's associated integration point.
      */
-    std :: vector< localIntegrationRecord > *NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(GaussPoint *gp) override;
+    NonlocalIntegrationList *NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(GaussPoint *gp) override;
     /**
      * Computes the "local" part of nonlocal stiffness contribution assembled for given integration point.
      * @param gp Source integration point.
@@ -95,7 +95,7 @@ public:
     void NonlocalMaterialStiffnessInterface_addIPContribution(SparseMtrx &dest, const UnknownNumberingScheme &s,
                                                               GaussPoint *gp, TimeStep *tStep) override;
 
-    std :: vector< localIntegrationRecord > *NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(GaussPoint *gp) override;
+    NonlocalIntegrationList *NonlocalMaterialStiffnessInterface_giveIntegrationDomainList(GaussPoint *gp) override;
 
     /**
      * Computes the "local" part of nonlocal stiffness contribution assembled for given integration point.
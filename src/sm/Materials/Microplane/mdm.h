@@ -271,7 +271,6 @@ protected:
                              GaussPoint *gp, TimeStep *tStep) const;
     void computeLocalDamageTensor(FloatMatrix &tempDamageTensor, const FloatArray &totalStrain,
                                   GaussPoint *gp, TimeStep *tStep) const;
-    double computeDamageOnPlane(GaussPoint *gp, int mnumber, const FloatArray &strain) const;
     void computePDC(FloatMatrix &tempDamageTensor, FloatArray &tempDamageTensorEigenVals,
                     FloatMatrix &tempDamageTensorEigenVec) const;
     void transformStrainToPDC(FloatArray &answer, FloatArray &strain,
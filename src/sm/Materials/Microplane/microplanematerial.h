@@ -69,6 +69,12 @@ protected:
      */
     std::vector<FloatArrayF<6>> L;
 
+    /**
+     * Projection tensors N, M, L of all microplanes in SoA layout (component i of microplane m at i * numberOfMicroplanes + m),
+     * used by the kernels evaluating all microplanes at once.
+     */
+    std::vector<double> projN, projM, projL;
+
     /// Young's modulus
     double E = 0.;
 
@@ -109,6 +115,31 @@ public:
      * vector on given microplane.
      */
     MicroplaneState computeStrainVectorComponents(int mnumber, const FloatArray &macroStrain) const;
+    /**
+     * Computes the normal and shear strain components on all microplanes (vectorized over microplanes).
+     * @param macroStrain Macro strain in full form.
+     * @param en Normal strains, array of numberOfMicroplanes values.
+     * @param em Shear strains in m direction.
+     * @param el Shear strains in l direction.
+     */
+    void computeStrainComponents(const FloatArrayF<6> &macroStrain, double *en, double *em, double *el) const;
+    /**
+     * Integrates microplane stresses into macro stress, sum of w ( (N - delta/3) sd + M sm + L sl ) over microplanes.
+     * @param sd Deviatoric normal stresses on microplanes.
+     * @param sm Shear stresses in m direction.
+     * @param sl Shear stresses in l direction.
+     */
+    FloatArrayF<6> integrateStressComponents(const double *sd, const double *sm, const double *sl) const;
+    /**
+     * Integrates given values weighted by normal projection tensors, sum of N f over microplanes.
+     * The integration weights are not applied.
+     */
+    FloatArrayF<6> integrateNormalProjection(const double *f) const;
+    /**
+     * Integrates the stiffness of microplanes with normal moduli, sum of f N x N over microplanes.
+     * The integration weights are not applied.
+     */
+    FloatMatrixF<6,6> integrateNormalStiffness(const double *f) const;
 
 
     /**
@@ -124,6 +155,8 @@ public:
      * @param numberOfMicroplanes Number of required microplanes.
      */
     virtual void initializeData(int numberOfMicroplanes);
+    /// Sets up projection tensors in SoA layout from N, M, L, must be called when they change.
+    void initializeProjectionArrays();
 
     FloatMatrixF<6,6> give3dMaterialStiffnessMatrix(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) const override;
 
@@ -7,19 +7,26 @@
 
 #include "sm/Materials/Structural/structuralmaterial.h"
 #include "sm/Materials/Structural/structuralms.h"
+#include "input/oofemtxtdatareader.h"
+#include "utility/statecountertype.h"
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 ///@name Input fields for StructuralFE2Material
 //@{
 #define _IFT_StructuralFE2Material_Name "structfe2material"
 #define _IFT_StructuralFE2Material_fileName "filename"
 #define _IFT_StructuralFE2Material_useNumericalTangent "use_num_tangent"
+#define _IFT_StructuralFE2Material_shareRveInput "sharerveinput"
+#define _IFT_StructuralFE2Material_batched "batched"
 //@}
 
 namespace oofem {
 class EngngModel;
 class PrescribedGradientHomogenization;
+class SparseMtrxStructureCache;
 
 class StructuralFE2MaterialStatus : public StructuralMaterialStatus
 {
@@ -37,8 +44,22 @@ protected:
 
     std :: string mInputFile;
 
+    /// Strain and stress of the last batched RVE solve.
+    FloatArrayF< 6 >batchStrain, batchStress;
+    /// Number of the batch of the last batched RVE solve, -1 if there is no valid result.
+    int batchNumber = -1;
+    /// Wall time of the last RVE solve.
+    double solveTime = 0.;
+
 public:
     StructuralFE2MaterialStatus(int rank, GaussPoint * g,  const std :: string & inputfile);
+    /**
+     * Creates the RVE from already parsed input.
+     * @param rveInput Parsed RVE input, copied (the file is not read again).
+     * @param structures Sparse matrix structures shared by the RVEs.
+     */
+    StructuralFE2MaterialStatus(int rank, GaussPoint * g, const OOFEMTXTDataReader & rveInput,
+                                std :: shared_ptr< SparseMtrxStructureCache > structures);
 
     EngngModel *giveRVE() const { return this->rve.get(); }
     PrescribedGradientHomogenization *giveBC();// { return this->bc; }
@@ -48,10 +69,32 @@ public:
 
     /// Creates/Initiates the RVE problem.
     bool createRVE(int n, const std :: string &inputfile, int rank);
+    /// Creates/Initiates the RVE problem from given input.
+    bool createRVE(int n, DataReader &dr, int rank);
 
     /// Copies time step data to RVE.
     void setTimeStep(TimeStep *tStep);
 
+    /**
+     * Solves the RVE for given macroscopic strain.
+     * The temporary strain and stress of the receiver are not changed; the tangent is marked as old.
+     * @return Homogenized stress in 3d Voigt form.
+     */
+    FloatArrayF< 6 >solveRVE(const FloatArrayF< 6 > &strain, TimeStep *tStep);
+    /// Stores result of batched RVE solve.
+    void setBatchResult(const FloatArrayF< 6 > &strain, const FloatArrayF< 6 > &stress, int batch);
+    /**
+     * Gives the stress of the batched RVE solve, if it was done in given batch for the same strain.
+     * @return True if the result is valid.
+     */
+    bool giveBatchResult(FloatArrayF< 6 > &stress, const FloatArrayF< 6 > &strain, int batch) const;
+    /// Invalidates the batched result (the RVE was solved for different strain).
+    void clearBatchResult() { batchNumber = -1; }
+    /// Returns wall time of the last RVE solve.
+    double giveSolveTime() const { return solveTime; }
+    /// Returns true if tangent has to be recomputed.
+    bool isTangentOld() const { return oldTangent; }
+
     FloatMatrix &giveTangent() { return tangent; }
 
     const char *giveClassName() const override { return "StructuralFE2MaterialStatus"; }
@@ -85,6 +128,17 @@ public:
  * - It must have a PrescribedGradient boundary condition.
  * - It must be the first boundary condition
  *
+ * In the shared RVE input mode (sharerveinput), the RVE input file is parsed once and the RVEs of all Gauss points
+ * are instantiated from the parsed records. The RVEs also share the sparse matrix structures (and symbolic
+ * factorizations) of their stiffness matrices, which are built only by the first RVE solved. The mesh is not shared,
+ * each RVE still instantiates its own domain (with its integration point states) and numbers its equations.
+ *
+ * In the batched mode, the first stress (or tangent) request in a new solution state triggers the solution of
+ * all RVEs of the material at once: the macroscopic strains of all Gauss points are evaluated and the independent RVE
+ * problems are solved concurrently, starting with the RVEs which took longest in the previous batch. The results are
+ * stored in the statuses and returned by the subsequent requests of the macro assembly (the RVE is solved again
+ * only if the requested strain differs). The wall times of the RVE solves are reported in the log.
+ *
  * @author Mikael Öhman 
  */
 class StructuralFE2Material : public StructuralMaterial
@@ -93,6 +147,21 @@ protected:
     std :: string inputfile;
     static int n;
     bool useNumTangent = false;
+    /// Parsed RVE input (shared RVE input mode).
+    std :: unique_ptr< OOFEMTXTDataReader > rveInput;
+    /// Sparse matrix structures shared by the RVEs (shared RVE input mode).
+    std :: shared_ptr< SparseMtrxStructureCache > rveStructures;
+    /// Flag for batched RVE solves.
+    bool batched = false;
+    /**
+     * Solution state counters of the last stress and tangent batches. The RVEs are solved with the macro time step,
+     * which changes its counter, so the counters are taken after the RVE solves.
+     */
+    mutable StateCounterType stressBatchCounter = -1, tangentBatchCounter = -1;
+    /// Number of the last stress batch.
+    mutable int stressBatchNumber = 0;
+    /// Serializes the batches triggered from concurrent assembly.
+    mutable std :: mutex batchMutex;
 
 public:
     StructuralFE2Material(int n, Domain * d);
@@ -109,6 +178,17 @@ public:
     FloatMatrixF<6,6> give3dMaterialStiffnessMatrix(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) const override;
     FloatMatrixF<4,4> givePlaneStrainStiffMtrx(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) const override;
     FloatMatrixF<3,3> givePlaneStressStiffMtrx(MatResponseMode mmode, GaussPoint *gp, TimeStep *tStep) const override;
+
+protected:
+    /// Collects the integration points of the domain evaluated by the receiver, together with their statuses.
+    void giveBatchPoints(std :: vector< std :: pair< GaussPoint *, StructuralFE2MaterialStatus * > > &answer) const;
+    /**
+     * Solves the RVEs of all integration points concurrently for the current strains (once per solution state).
+     * @return Number of the batch.
+     */
+    int solveStressBatch(TimeStep *tStep) const;
+    /// Computes the old tangents of all integration points concurrently (once per solution state).
+    void computeTangentBatch(TimeStep *tStep) const;
 };
 
 } // end namespace oofem
@@ -155,6 +155,19 @@ public:
                                       const FloatArray &reducedStrain, TimeStep *tStep);
     /// Default implementation relies on giveRealStressVector for second Piola-Kirchoff stress
     virtual FloatArrayF< 6 >giveRealStressVector_3d(const FloatArrayF< 6 > &strain, GaussPoint *gp, TimeStep *tStep) const;
+    /**
+     * Computes the real stress vectors of a batch of integration points in 3d mode.
+     * Equivalent to calling giveRealStressVector_3d for each point (in the given order), but allows the material
+     * to evaluate the points together (e.g. the elastic predictor in structure-of-arrays form, vectorized over points).
+     * All points must belong to this material, their statuses are updated in the same way as by the scalar service.
+     * Default implementation loops over the points and calls giveRealStressVector_3d.
+     * @param answer Stress vectors of points.
+     * @param strain Strain vectors of points.
+     * @param gp Integration points.
+     * @param tStep Current time step.
+     */
+    virtual void giveRealStressVectors_3d(std::vector< FloatArrayF< 6 > > &answer, const std::vector< FloatArrayF< 6 > > &strain,
+                                          const std::vector< GaussPoint * > &gp, TimeStep *tStep) const;
     /// Default implementation relies on giveRealStressVector_3d
     virtual FloatArrayF< 4 >giveRealStressVector_PlaneStrain(const FloatArrayF< 4 > &strain, GaussPoint *gp, TimeStep *tStep) const;
     /// Iteratively calls giveRealStressVector_3d to find the stress controlled equal to zero·
@@ -57,6 +57,18 @@ protected:
     /// Temporary deformation gradient in reduced form (to find balanced state)
     FloatArray tempFVector;
 
+    /**
+     * Stress, strain, P, C and F vectors whose temporary or equilibrated value was modified since they were last
+     * synchronized. The commit and the rollback copy only these vectors, the remaining temporary vectors are already
+     * equal to the equilibrated ones. Derived classes must modify the vectors through the let methods.
+     */
+    enum TempVectorFlags { TVF_Stress = 1, TVF_Strain = 2, TVF_P = 4, TVF_C = 8, TVF_F = 16, TVF_All = 31 };
+    /// Modified vectors (combination of TempVectorFlags).
+    int modifiedTempVectors;
+
+    /// Resets given temporary vectors to the equilibrated ones.
+    void resetTempVectors(int flags);
+
 public:
     /// Constructor. Creates new StructuralMaterialStatus with IntegrationPoint g.
     StructuralMaterialStatus(GaussPoint * g);
@@ -90,25 +102,25 @@ public:
     /// Returns the const pointer to receiver's temporary deformation gradient vector.
     const FloatArray &giveTempFVector() const { return tempFVector; }
     /// Assigns strain vector to given vector v.
-    void letStrainVectorBe(const FloatArray &v) { strainVector = v; }
+    void letStrainVectorBe(const FloatArray &v) { strainVector = v; modifiedTempVectors |= TVF_Strain; }
     /// Assigns stressVector to given vector v.
-    void letStressVectorBe(const FloatArray &v) { stressVector = v; }
+    void letStressVectorBe(const FloatArray &v) { stressVector = v; modifiedTempVectors |= TVF_Stress; }
     /// Assigns PVector to given vector v.
-    void letPVectorBe(const FloatArray &v) { PVector = v; }
+    void letPVectorBe(const FloatArray &v) { PVector = v; modifiedTempVectors |= TVF_P; }
     /// Assigns CVector to given vector v.
-    void letCVectorBe(const FloatArray &v) { CVector = v; }
+    void letCVectorBe(const FloatArray &v) { CVector = v; modifiedTempVectors |= TVF_C; }
     /// Assigns FVector to given vector v.
-    void letFVectorBe(const FloatArray &v) { FVector = v; }
+    void letFVectorBe(const FloatArray &v) { FVector = v; modifiedTempVectors |= TVF_F; }
     /// Assigns tempStressVector to given vector v.
-    void letTempStressVectorBe(const FloatArray &v) { tempStressVector = v; }
+    void letTempStressVectorBe(const FloatArray &v) { tempStressVector = v; modifiedTempVectors |= TVF_Stress; }
     /// Assigns tempStrainVector to given vector v
-    void letTempStrainVectorBe(const FloatArray &v) { tempStrainVector = v; }
-    /// Assigns tempPVector to given vector v
-    void letTempPVectorBe(const FloatArray &v) { tempPVector = v; }
+    void letTempStrainVectorBe(const FloatArray &v) { tempStrainVector = v; modifiedTempVectors |= TVF_Strain; }
     /// Assigns tempPVector to given vector v
-    void letTempCVectorBe(const FloatArray &v) { tempCVector = v; }
+    void letTempPVectorBe(const FloatArray &v) { tempPVector = v; modifiedTempVectors |= TVF_P; }
+    /// Assigns tempCVector to given vector v
+    void letTempCVectorBe(const FloatArray &v) { tempCVector = v; modifiedTempVectors |= TVF_C; }
     /// Assigns tempFVector to given vector v
-    void letTempFVectorBe(const FloatArray &v) { tempFVector = v; }
+    void letTempFVectorBe(const FloatArray &v) { tempFVector = v; modifiedTempVectors |= TVF_F; }
 
     const char *giveClassName() const override { return "StructuralMaterialStatus"; }
 
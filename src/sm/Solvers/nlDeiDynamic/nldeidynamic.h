@@ -8,10 +8,13 @@
 #include "sm/EngineeringModels/structengngmodel.h"
 #include "math/floatarray.h"
 #include "math/floatmatrix.h"
+#include "math/intarray.h"
 #include "solvers/sparselinsystemnm.h"
 #include "math/sparsemtrxtype.h"
 
 #include <memory>
+#include <vector>
+#include <cmath>
 
 #define LOCAL_ZERO_MASS_REPLACEMENT 1
 
@@ -25,6 +28,8 @@
 #define _IFT_NlDEIDynamic_py "py"
 #define _IFT_NlDEIDynamic_nonlocalext "nonlocalext"
 #define _IFT_NlDEIDynamic_reduct "reduct"
+#define _IFT_NlDEIDynamic_dtupdate "dtupdate" ///< Number of steps between updates of the element stable time step (0 = at start only)
+#define _IFT_NlDEIDynamic_subcycling "subcycling" ///< Number of subcycling levels (time step classes 1, 2, ..., 2^n of the finest step)
 //@}
 
 namespace oofem {
@@ -43,6 +48,21 @@ namespace oofem {
  * solution in step t+dt. But printing is performed for step t.
  * So, when analyst specifies initial conditions, then he/she specifies them in time step 0.
  *
+ * The internal forces are evaluated element by element on all threads, every thread assembles into its own buffer
+ * and the buffers are summed over slices of equations, so no locking is needed. The time step is limited by the
+ * stable time step of the elements, 2/omega_e, where omega_e is estimated from the diagonals of element
+ * stiffness and lumped mass matrices. The estimate can be repeated every dtupdate steps; the time step then follows
+ * the current stiffness, but never exceeds the deltat given in input.
+ *
+ * With subcycling n > 0, the time step of the model is split into 2^n substeps of size h. Elements are binned by
+ * their stable time step into classes with steps h, 2h, ..., 2^n h, every equation is integrated with the step of
+ * the finest class of its elements. In a substep, equations of classes starting a new step are advanced and
+ * updated, displacements of the other (interface) equations are interpolated linearly within their step, and only
+ * elements having an updated equation are evaluated. Elements see the time increment of their class and their material
+ * statuses are updated at the end of every step of their class, so rate dependent materials get their own strain rates.
+ * All classes are synchronised at the end of the model step. Dynamic relaxation and parallel runs are not supported
+ * with subcycling.
+ *
  * Current implementation supports parallel processing. Both node- and element cut strategies can
  * be used.
  * - In node cut strategy, partitions are divided using cut, which goes through nodes.
@@ -79,6 +99,20 @@ protected:
     int initFlag;
     /// Optional reduction factor for time step deltaT
     double reductionFactor;
+    /// Time step given in input (upper bound of deltaT).
+    double userDeltaT;
+    /// Number of steps between updates of the element stable time step (0 = estimate at start only).
+    int dtUpdateInterval;
+    /// Stable time steps of elements (infinite for elements without stiffness or mass).
+    FloatArray elementTimeSteps;
+    /// Internal forces assembled by threads other than the first one.
+    std :: vector< FloatArray >threadForces;
+    /// Number of subcycling levels (0 = no subcycling).
+    int subcyclingLevels;
+    /// Subcycling class of equations and elements (the step of class m is 2^m times the finest step).
+    IntArray equationLevels, elementLevels;
+    /// Displacements of equations at the beginning of their current step (subcycling).
+    FloatArray subcycleDisplacement;
     // dynamic relaxation specific vars
     /// Flag indicating whether dynamic relaxation takes place.
     int drFlag;
@@ -148,6 +182,39 @@ protected:
      */
     void computeMassMtrx(FloatArray &mass, double &maxOm, TimeStep *tStep);
     void computeMassMtrx2(FloatMatrix &mass, double &maxOm, TimeStep *tStep);
+    /**
+     * Assembles the internal forces vector in parallel, every thread assembles the element contributions
+     * into its own buffer. Contributions of active boundary conditions are added and shared equations exchanged.
+     * @param answer Internal forces.
+     * @param tStep Time step.
+     * @param substep Subcycling substep, only elements of classes starting a new step are evaluated.
+     */
+    void computeInternalForces(FloatArray &answer, TimeStep *tStep, int substep = 0);
+    /**
+     * Computes the stable time step of every element from the diagonals of its lumped mass and tangent stiffness.
+     * @param answer Stable time steps of elements.
+     * @param tStep Time step.
+     * @return Minimum stable time step (over all processes).
+     */
+    double computeElementTimeSteps(FloatArray &answer, TimeStep *tStep);
+    /**
+     * Sets the time step to the smaller of given stable time step and input time step.
+     * The number of steps is updated to keep the end time, the last displacement increment is rescaled.
+     * @param tStep Current time step.
+     * @param maxDt Stable time step.
+     */
+    void updateTimeStep(TimeStep *tStep, double maxDt);
+    /**
+     * Bins elements into subcycling classes by their stable time steps and assigns the equations the finest class
+     * of their elements. Increments of equations changing class are rescaled to keep their velocity.
+     */
+    void computeSubcyclingLevels();
+    /// Solves the step by subcycling (the model time step is the step of the coarsest class).
+    void solveSubcycledStep(TimeStep *tStep);
+    /// Returns the time step of given equation (step of its subcycling class).
+    double giveEquationTimeStep(int eq) const {
+        return subcyclingLevels > 0 ? ldexp(deltaT, equationLevels.at(eq) - subcyclingLevels) : deltaT;
+    }
 
 public:
     int estimateMaxPackSize(IntArray &commMap, DataStream &buff, int packUnpackType) override;
@@ -0,0 +1,37 @@
+#
+# this test converts text input file to binary input file and runs the analysis from the binary file,
+# the nodes, elements and sets have to be stored in typed blocks (except element 1, which has a field
+# without typed block) and both runs have to write the same output file
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+echo "Command: $OOFEM -f binaryinput01.in.0"
+$OOFEM -f binaryinput01.in.0 || exit 1
+mv binaryinput01.out binaryinput01.out.txt
+
+echo "Command: $OOFEM -f binaryinput01.in.0 -b binaryinput01.bin"
+$OOFEM -f binaryinput01.in.0 -b binaryinput01.bin > binaryinput01.log 2>&1
+status=$?
+cat binaryinput01.log
+if [ $status -ne 0 ]; then
+    rm -f binaryinput01.log binaryinput01.out.txt
+    exit 1
+fi
+if ! grep -q "6 nodes, 1 elements and 4 sets in typed blocks, 12 text records" binaryinput01.log; then
+    echo "Error: unexpected number of records in typed blocks"
+    status=1
+fi
+
+echo "Command: $OOFEM -f binaryinput01.bin"
+$OOFEM -f binaryinput01.bin || status=1
+
+# the outputs differ only in the solution and user times
+if ! diff -I "time" binaryinput01.out.txt binaryinput01.out; then
+    echo "Error: output of binary input differs from output of text input"
+    status=1
+fi
+
+rm -f binaryinput01.bin binaryinput01.log binaryinput01.out.txt
+exit $status
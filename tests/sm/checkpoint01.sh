@@ -0,0 +1,61 @@
+#
+# this test checks save/restore of asynchronous incremental (compressed) context files; it needs two runs
+# (storing the context files and restarting from them), the results of both runs are checked by the check
+# block of checkpoint01.in.0, this script checks only the layout of the stored files
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+# size of context file, stored in the header after magic, version and kind
+contextSize() {
+    od -An -t u8 -j 16 -N 8 "$1" | tr -d ' '
+}
+
+# number of blocks stored as unchanged since the base, each block starts with a flag (0 = unchanged)
+# and the size of the stored data
+unchangedBlocks() {
+    local size=$(stat -c %s "$1")
+    local offset=$((36 + $(od -An -t u4 -j 32 -N 4 "$1" | tr -d ' ')))
+    local n=0
+    while [ $offset -lt $size ]; do
+        if [ $(od -An -t u1 -j $offset -N 1 "$1" | tr -d ' ') -eq 0 ]; then
+            n=$((n + 1))
+        fi
+        offset=$((offset + 5 + $(od -An -t u4 -j $((offset + 1)) -N 4 "$1" | tr -d ' ')))
+    done
+    echo $n
+}
+
+echo "Command: $OOFEM -f checkpoint01.in.0 -c"
+# run target on input and store context files (full snapshots at steps 1 and 4, increments at steps 2 and 3)
+$OOFEM -f checkpoint01.in.0 -c || exit 1
+
+status=0
+for step in 1 2 3 4; do
+    fname=checkpoint01.out.0.$step.0.osf
+    if [ ! -f $fname ]; then
+        echo "Error: context file $fname not written"
+        exit 1
+    fi
+    echo "$fname: context size $(contextSize $fname), file size $(stat -c %s $fname), unchanged blocks $(unchangedBlocks $fname)"
+done
+# the context spans several blocks and the increments store only the blocks changed since step 1
+# (the clamped part of the plate is not changed)
+if [ $(contextSize checkpoint01.out.0.1.0.osf) -le 65536 ]; then
+    echo "Error: context fits into a single block"
+    status=1
+fi
+for step in 2 3; do
+    if [ $(unchangedBlocks checkpoint01.out.0.$step.0.osf) -eq 0 ]; then
+        echo "Error: incremental context file of step $step stores all blocks"
+        status=1
+    fi
+done
+
+echo "Command: $OOFEM -f checkpoint01.in.0 -r 3"
+# restart from the incremental context file of step 3, the results of step 4 are checked
+$OOFEM -f checkpoint01.in.0 -r 3 || status=1
+
+rm -f checkpoint01.out.0.*.osf
+exit $status
@@ -0,0 +1,42 @@
+#
+# this test runs the quasi-Newton decks nrsolverlbfgs01.in.0 and nrsolverbroyden01.in.0 (the values are checked
+# by the decks) and the same decks without qnmode (modified Newton-Raphson). The quasi-Newton iterations have to
+# save tangent factorizations in every plastic step and need fewer iterations than modified Newton-Raphson
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+# prints total number of iterations of all steps in given log
+iterations() {
+    awk '/^NRSolver: [0-9]+ / { it = $2 } /Solving step/ { s += it; it = 0 } END { print s + it }' $1
+}
+
+status=0
+for deck in nrsolverlbfgs01 nrsolverbroyden01; do
+    echo "Command: $OOFEM -f $deck.in.0"
+    $OOFEM -f $deck.in.0 > $deck.log 2>&1 || status=1
+    cat $deck.log
+
+    # the same deck without quasi-Newton updates, written to its own output file
+    sed -e "1s/.*/${deck}_mnr.out/" -e "s/ qnmode [0-9]//" $deck.in.0 > ${deck}_mnr.in
+    echo "Command: $OOFEM -f ${deck}_mnr.in"
+    $OOFEM -f ${deck}_mnr.in > ${deck}_mnr.log 2>&1 || status=1
+
+    nsteps=$(grep -c "NRSolver: .* tangent factorizations" $deck.log)
+    nunsaved=$(grep -c "NRSolver: .* tangent factorizations (0 saved)" $deck.log)
+    nit=$(iterations $deck.log)
+    nitmnr=$(iterations ${deck}_mnr.log)
+    rm -f $deck.log ${deck}_mnr.in ${deck}_mnr.log ${deck}_mnr.out
+    # the first step is elastic and converges in one iteration, the other 4 steps are plastic
+    echo "$deck: steps $nsteps, steps without saved factorizations $nunsaved, iterations $nit (modified NR $nitmnr)"
+    if [ $nsteps -ne 5 ] || [ $nunsaved -ne 1 ]; then
+        echo "Error: tangent factorizations not saved by quasi-Newton iterations"
+        status=1
+    fi
+    if [ $nit -eq 0 ] || [ $nit -ge $nitmnr ]; then
+        echo "Error: quasi-Newton iterations do not converge faster than modified Newton-Raphson"
+        status=1
+    fi
+done
+exit $status